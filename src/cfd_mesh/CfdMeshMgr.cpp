@@ -11,6 +11,8 @@
 #include "Util.h"
 #include "SubSurfaceMgr.h"
 #include "main.h"
+#include "PntNodeMerge.h"
+#include "FileUtil.h"
 
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
@@ -957,13 +959,23 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     MSCloud ms_cloud;
     vector< MapSource* > allsources;
 
+    // Surfaces only query the shared sources, so the index must be ready
+    // before the parallel loop below.
+    GetGridDensityPtr()->BuildSourceIndex();
+
     int i;
+    #pragma omp parallel for schedule( dynamic )
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
+        m_SurfVec[i]->BuildTargetMap( i );
         m_SurfVec[i]->LimitTargetMap();
     }
 
+    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        m_SurfVec[i]->LoadTargetMapSources( allsources );
+    }
+
     // Set up split sources to provide a source at the endpoint of curves where
     // mesh information is hard to transfer.
     list< MapSource* > splitSources;
@@ -1008,29 +1020,40 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
             addOutputText( " Rigorous 3D Limiting\n", output_type );
         }
 
-        for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        // One tree over every surface's sources.  Each surface excludes its own sources
+        // during the search, rather than building a tree of all the other surfaces.
+        ms_cloud.sources = allsources;
+
+        MSTree ms_tree( 3, ms_cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+        ms_tree.buildIndex();
+
+        // Current minimum strength on each surface.
+        int nsurf = ( int )m_SurfVec.size();
+        vector< double > surf_min( nsurf, numeric_limits<double>::max( ) );
+        for( int j = 0; j < ( int )allsources.size(); j++ )
         {
-            ms_cloud.sources.clear();
-            ms_cloud.sources.reserve( allsources.size() );
+            int sid = allsources[j]->m_surfid;
+            surf_min[ sid ] = min( surf_min[ sid ], allsources[j]->m_str );
+        }
 
+        for ( i = 0 ; i < nsurf ; i++ )
+        {
             double minmap = numeric_limits<double>::max( );
 
-            for( int j = 0; j < ( int )allsources.size(); j++ )
+            for( int j = 0; j < nsurf; j++ )
             {
-                if( allsources[j]->m_surfid != i )
+                if( j != i && surf_min[j] < minmap )
                 {
-                    if( allsources[j]->m_str < minmap )
-                    {
-                        minmap = allsources[j]->m_str;
-                    }
-                    ms_cloud.sources.push_back( allsources[j] );
+                    minmap = surf_min[j];
                 }
             }
 
-            MSTree ms_tree( 3, ms_cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
-            ms_tree.buildIndex();
+            if ( minmap < numeric_limits<double>::max( ) )
+            {
+                m_SurfVec[i]->LimitTargetMap( ms_cloud, ms_tree, minmap, i );
+            }
 
-            m_SurfVec[i]->LimitTargetMap( ms_cloud, ms_tree, minmap );
+            surf_min[i] = m_SurfVec[i]->GetMinTargetMap();
         }
 
         for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); c++ )
@@ -1054,28 +1077,67 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
+    int num_reused = 0;
+    map< size_t, SurfRemeshRecord > new_cache;
+    vector< double > key;
     for ( int i = 0 ; i < nsurf ; ++i )
     {
         int num_tris = 0;
 
         int num_rev_removed = 0;
 
-        for ( int iter = 0 ; iter < 10 ; ++iter )
-        {
-            num_tris = 0;
-            m_SurfVec[i]->GetMesh()->Remesh();
-
-            num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
+        Mesh* mesh = m_SurfVec[i]->GetMesh();
+        mesh->GetRemeshInputKey( key );
+        size_t hash = HashKey( key );
 
+        //==== Surface, Borders, And Sources Unchanged Since Last Run - Reuse Its Mesh ====//
+        map< size_t, SurfRemeshRecord >::iterator it = m_RemeshCache.find( hash );
+        if ( it != m_RemeshCache.end() && it->second.m_Key == key )
+        {
+            SurfRemeshRecord & rec = it->second;
+            mesh->GetSimpTriVec() = rec.m_SimpTriVec;
+            mesh->GetSimpPntVec() = rec.m_SimpPntVec;
+            mesh->GetSimpUWPntVec() = rec.m_SimpUWPntVec;
+            new_cache[hash] = rec;
 
-            num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
+            num_tris = ( int )rec.m_SimpTriVec.size();
+            num_rev_removed = rec.m_NumRevRemoved;
+            num_reused++;
 
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+            sprintf( str, "Surf %d/%d Unchanged Num Tris = %d\n", i + 1, nsurf, num_tris );
             if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
             {
                 addOutputText( str, output_type );
             }
         }
+        else
+        {
+            for ( int iter = 0 ; iter < 10 ; ++iter )
+            {
+                num_tris = 0;
+                mesh->Remesh();
+
+                num_rev_removed = mesh->RemoveRevTris();
+
+
+                num_tris += mesh->GetTriList().size();
+
+                sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+                if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+                {
+                    addOutputText( str, output_type );
+                }
+            }
+
+            mesh->LoadSimpTris();
+
+            SurfRemeshRecord & rec = new_cache[hash];
+            rec.m_Key = key;
+            rec.m_SimpTriVec = mesh->GetSimpTriVec();
+            rec.m_SimpPntVec = mesh->GetSimpPntVec();
+            rec.m_SimpUWPntVec = mesh->GetSimpUWPntVec();
+            rec.m_NumRevRemoved = num_rev_removed;
+        }
         total_num_tris += num_tris;
 
         if ( num_rev_removed > 0 )
@@ -1087,17 +1149,25 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
             }
         }
 
-        m_SurfVec[i]->GetMesh()->LoadSimpTris();
-        m_SurfVec[i]->GetMesh()->Clear();
+        mesh->Clear();
         if ( GetSettingsPtr()->m_IntersectSubSurfs )
         {
             Subtag( m_SurfVec[i] );
         }
-        m_SurfVec[i]->GetMesh()->CondenseSimpTris();
+        mesh->CondenseSimpTris();
     }
 
+    //==== Keep Only Surfaces Seen This Run ====//
+    m_RemeshCache.swap( new_cache );
+
     m_WakeMgr.StretchWakes();
 
+    if ( num_reused > 0 )
+    {
+        sprintf( str, "%d/%d Surfaces Reused From Last Mesh\n", num_reused, nsurf );
+        addOutputText( str, output_type );
+    }
+
     sprintf( str, "Total Num Tris = %d\n", total_num_tris );
     addOutputText( str, output_type );
 }
@@ -1181,7 +1251,11 @@ void CfdMeshMgrSingleton::ExportFiles()
 {
     if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME ) )
     {
-        if ( !m_Vehicle->m_STLMultiSolid() )
+        if ( GetCfdSettingsPtr()->m_STLBinaryFlag )
+        {
+            WriteBinarySTL( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
+        }
+        else if ( !m_Vehicle->m_STLMultiSolid() )
         {
             WriteSTL( GetCfdSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
         }
@@ -1254,6 +1328,113 @@ void CfdMeshMgrSingleton::ExportFiles()
 
 }
 
+//==== ASCII STL Facets Of Selected Tris ====//
+class STLTriWriter : public TextRecordWriter
+{
+public:
+    STLTriWriter( const vector< SimpTri > & tri_vec, const vector< vec3d* > & pnt_vec, const vector< int > & ind_vec ) :
+        m_TriVec( tri_vec ), m_PntVec( pnt_vec ), m_IndVec( ind_vec )   {}
+
+protected:
+    virtual void FormatRecord( int i, string & out )
+    {
+        const SimpTri & stri = m_TriVec[ m_IndVec[i] ];
+        const vec3d & p0 = *m_PntVec[ stri.ind0 ];
+        const vec3d & p1 = *m_PntVec[ stri.ind1 ];
+        const vec3d & p2 = *m_PntVec[ stri.ind2 ];
+        vec3d v10 = p1 - p0;
+        vec3d v20 = p2 - p1;
+        vec3d norm = cross( v10, v20 );
+        norm.normalize();
+
+        Append( out, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
+        out += "   outer loop\n";
+
+        Append( out, "     vertex %2.10le %2.10le %2.10le\n", p0.x(), p0.y(), p0.z() );
+        Append( out, "     vertex %2.10le %2.10le %2.10le\n", p1.x(), p1.y(), p1.z() );
+        Append( out, "     vertex %2.10le %2.10le %2.10le\n", p2.x(), p2.y(), p2.z() );
+
+        out += "   endloop\n";
+        out += " endfacet\n";
+    }
+
+    const vector< SimpTri > & m_TriVec;
+    const vector< vec3d* > & m_PntVec;
+    const vector< int > & m_IndVec;
+};
+
+//==== Numbered Points - Index Gives The Point And Its 1 Based Label ====//
+class NumberedPntWriter : public TextRecordWriter
+{
+public:
+    NumberedPntWriter( const char* fmt, const vector< vec3d* > & pnt_vec, const vector< int > & ind_vec ) :
+        m_Fmt( fmt ), m_PntVec( pnt_vec ), m_IndVec( ind_vec )  {}
+
+protected:
+    virtual void FormatRecord( int i, string & out )
+    {
+        int ind = m_IndVec[i];
+        Append( out, m_Fmt, ind + 1, m_PntVec[ind]->x(), m_PntVec[ind]->y(), m_PntVec[ind]->z() );
+    }
+
+    const char* m_Fmt;
+    const vector< vec3d* > & m_PntVec;
+    const vector< int > & m_IndVec;
+};
+
+//==== Unnumbered Points ====//
+class PntWriter : public TextRecordWriter
+{
+public:
+    PntWriter( const char* fmt, const vector< vec3d* > & pnt_vec ) : m_Fmt( fmt ), m_PntVec( pnt_vec )    {}
+
+protected:
+    virtual void FormatRecord( int i, string & out )
+    {
+        Append( out, m_Fmt, m_PntVec[i]->x(), m_PntVec[i]->y(), m_PntVec[i]->z() );
+    }
+
+    const char* m_Fmt;
+    const vector< vec3d* > & m_PntVec;
+};
+
+//==== TetGen Facets - One Polygon Of Three 1 Based Nodes ====//
+class TetGenTriWriter : public TextRecordWriter
+{
+public:
+    TetGenTriWriter( const vector< SimpTri > & tri_vec ) : m_TriVec( tri_vec )   {}
+
+protected:
+    virtual void FormatRecord( int i, string & out )
+    {
+        out += "1\n";
+        Append( out, "3 %d %d %d\n", m_TriVec[i].ind0, m_TriVec[i].ind1, m_TriVec[i].ind2 );
+    }
+
+    const vector< SimpTri > & m_TriVec;
+};
+
+//==== Xpatch Facets Of One Part - Nodes, Material, Component, And Running Facet Number ====//
+class FacetTriWriter : public TextRecordWriter
+{
+public:
+    FacetTriWriter( const vector< SimpTri > & tri_vec, const vector< int > & ind_vec, int material_id, int comp_id, int facet_start ) :
+        m_TriVec( tri_vec ), m_IndVec( ind_vec ), m_MaterialID( material_id ), m_CompID( comp_id ), m_FacetStart( facet_start ) {}
+
+protected:
+    virtual void FormatRecord( int i, string & out )
+    {
+        const SimpTri & stri = m_TriVec[ m_IndVec[i] ];
+        Append( out, "%d %d %d %d %d %d\n", stri.ind0, stri.ind1, stri.ind2, m_MaterialID, m_CompID, m_FacetStart + i + 1 );
+    }
+
+    const vector< SimpTri > & m_TriVec;
+    const vector< int > & m_IndVec;
+    int m_MaterialID;
+    int m_CompID;
+    int m_FacetStart;
+};
+
 void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
 {
     //==== Find All Points and Tri Counts ====//
@@ -1268,21 +1449,22 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    vector< int > indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
     //==== Assemble Normal Tris ====//
     vector< SimpTri > allTriVec;
+    int pntOffset = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+            int i0 = indMap[ pntOffset + sTriVec[t].ind0 ];
+            int i1 = indMap[ pntOffset + sTriVec[t].ind1 ];
+            int i2 = indMap[ pntOffset + sTriVec[t].ind2 ];
             SimpTri stri;
             stri.ind0 = pntShift[i0];
             stri.ind1 = pntShift[i1];
@@ -1290,6 +1472,7 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
             stri.m_Tags = sTriVec[t].m_Tags;
             allTriVec.push_back( stri );
         }
+        pntOffset += ( int )sPntVec.size();
     }
     //==== Assemble All Used Points ====//
     vector< vec3d* > allUsedPntVec;
@@ -1301,7 +1484,14 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
         }
     }
 
-    FILE* file_id = fopen( filename.c_str(), "w" );
+    //==== Tag Lookup Is Not Thread Safe - Resolve Tags Before Formatting ====//
+    vector< int > tri_tag_vec( allTriVec.size() );
+    for ( int j = 0; j < ( int ) allTriVec.size(); j++ )
+    {
+        tri_tag_vec[j] = SubSurfaceMgr.GetTag( allTriVec[j].m_Tags );
+    }
+
+    FILE* file_id = OpenBufferedFile( filename, "w" );
     if ( file_id )
     {
         std::vector< int > tags = SubSurfaceMgr.GetAllTags();
@@ -1310,32 +1500,18 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
             std::string tagname = SubSurfaceMgr.GetTagNames( i );
             fprintf( file_id, "solid %s\n", tagname.c_str() );
 
+            vector< int > ind_vec;
             for ( int j = 0; j < ( int ) allTriVec.size(); j++ )
             {
-                SimpTri* stri = &allTriVec[j];
-                int t = SubSurfaceMgr.GetTag( stri->m_Tags );
-
-                if ( t == tags[i] )
+                if ( tri_tag_vec[j] == tags[i] )
                 {
-                    vec3d* p0 = allUsedPntVec[stri->ind0];
-                    vec3d* p1 = allUsedPntVec[stri->ind1];
-                    vec3d* p2 = allUsedPntVec[stri->ind2];
-                    vec3d v10 = *p1 - *p0;
-                    vec3d v20 = *p2 - *p1;
-                    vec3d norm = cross( v10, v20 );
-                    norm.normalize();
-
-                    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                    fprintf( file_id, "   outer loop\n" );
-
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1->x(), p1->y(), p1->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
-
-                    fprintf( file_id, "   endloop\n" );
-                    fprintf( file_id, " endfacet\n" );
+                    ind_vec.push_back( j );
                 }
             }
+
+            STLTriWriter writer( allTriVec, allUsedPntVec, ind_vec );
+            writer.Write( file_id, ( int )ind_vec.size() );
+
             fprintf( file_id, "endsolid %s\n", tagname.c_str() );
         }
 
@@ -1345,43 +1521,119 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
 
 void CfdMeshMgrSingleton::WriteSTL( const string &filename )
 {
-    FILE* file_id = fopen( filename.c_str(), "w" );
+    FILE* file_id = OpenBufferedFile( filename, "w" );
     if ( file_id )
     {
+        //==== Gather Surface Tris Into One List So Formatting Spans Surfaces ====//
+        vector< SimpTri > tri_vec[2];
+        vector< vec3d* > pnt_vec[2];
         int numwake = 0;
-        fprintf( file_id, "solid\n" );
         for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
         {
-            if ( !m_SurfVec[i]->GetWakeFlag() )
+            int w = m_SurfVec[i]->GetWakeFlag() ? 1 : 0;
+            numwake += w;
+            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+
+            int offset = ( int )pnt_vec[w].size();
+            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
             {
-                m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
+                pnt_vec[w].push_back( &sPntVec[v] );
             }
-            else
+            for ( int t = 0 ; t < ( int )sTriVec.size() ; t++ )
             {
-                numwake++;
+                SimpTri stri = sTriVec[t];
+                stri.ind0 += offset;
+                stri.ind1 += offset;
+                stri.ind2 += offset;
+                tri_vec[w].push_back( stri );
             }
         }
-        fprintf( file_id, "endsolid\n" );
 
-        if( numwake > 0 )
+        for ( int w = 0 ; w < 2 ; w++ )
         {
-            fprintf( file_id, "solid wake\n" );
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+            if ( w == 1 && numwake == 0 )
             {
-                if ( m_SurfVec[i]->GetWakeFlag() )
-                {
-                    m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
-                }
+                continue;
             }
-            fprintf( file_id, "endsolid wake\n" );
+
+            vector< int > ind_vec( tri_vec[w].size() );
+            for ( int t = 0 ; t < ( int )ind_vec.size() ; t++ )
+            {
+                ind_vec[t] = t;
+            }
+
+            fprintf( file_id, w == 0 ? "solid\n" : "solid wake\n" );
+            STLTriWriter writer( tri_vec[w], pnt_vec[w], ind_vec );
+            writer.Write( file_id, ( int )ind_vec.size() );
+            fprintf( file_id, w == 0 ? "endsolid\n" : "endsolid wake\n" );
         }
         fclose( file_id );
     }
 }
 
+void CfdMeshMgrSingleton::WriteBinarySTL( const string &filename )
+{
+    FILE* file_id = OpenBufferedFile( filename, "wb" );
+    if ( !file_id )
+    {
+        return;
+    }
+
+    //==== 80 Byte Header And Tri Count ====//
+    char header[80];
+    memset( header, 0, sizeof( header ) );
+    snprintf( header, sizeof( header ), "OpenVSP %s CFD Mesh", VSPVERSION4 );
+    fwrite( header, sizeof( char ), 80, file_id );
+
+    unsigned int ntri = 0;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        ntri += ( unsigned int )m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
+    }
+    fwrite( &ntri, sizeof( unsigned int ), 1, file_id );
+
+    //==== Normal Surfaces First, Then Wakes - Same Order As ASCII ====//
+    char rec[50];
+    memset( rec, 0, sizeof( rec ) );
+    for ( int pass = 0 ; pass < 2 ; pass++ )
+    {
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        {
+            if ( m_SurfVec[i]->GetWakeFlag() != ( pass == 1 ) )
+            {
+                continue;
+            }
+
+            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            for ( int t = 0 ; t < ( int )sTriVec.size() ; t++ )
+            {
+                vec3d& p0 = sPntVec[sTriVec[t].ind0];
+                vec3d& p1 = sPntVec[sTriVec[t].ind1];
+                vec3d& p2 = sPntVec[sTriVec[t].ind2];
+                vec3d v10 = p1 - p0;
+                vec3d v20 = p2 - p1;
+                vec3d norm = cross( v10, v20 );
+                norm.normalize();
+
+                float vals[12] = { ( float )norm.x(), ( float )norm.y(), ( float )norm.z(),
+                                   ( float )p0.x(), ( float )p0.y(), ( float )p0.z(),
+                                   ( float )p1.x(), ( float )p1.y(), ( float )p1.z(),
+                                   ( float )p2.x(), ( float )p2.y(), ( float )p2.z() };
+
+                memcpy( rec, vals, sizeof( vals ) ); // Trailing 2 byte attribute count stays zero
+                fwrite( rec, sizeof( char ), 50, file_id );
+            }
+        }
+    }
+
+    fclose( file_id );
+}
+
 void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
 {
-    FILE* fp = fopen( filename.c_str(), "w" );
+    FILE* fp = OpenBufferedFile( filename, "w" );
     if ( !fp )
     {
         return;
@@ -1400,7 +1652,7 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    vector< int > indMap;
     vector< int > pntShift;
     int numPnts = BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1409,36 +1661,47 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     fprintf( fp, "%d 3 0 0\n", numPnts );
 
     //==== Write Model Pnts ====//
+    vector< int > usedIndVec;
+    usedIndVec.reserve( numPnts );
     for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
     {
         if ( pntShift[i] >= 0 )
         {
-            fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, allPntVec[i]->x(), allPntVec[i]->y(), allPntVec[i]->z() );
+            usedIndVec.push_back( i );
         }
     }
 
+    NumberedPntWriter pnt_writer( "%d %.16g %.16g %.16g\n", allPntVec, usedIndVec );
+    pnt_writer.Write( fp, ( int )usedIndVec.size() );
+
     //==== Write Tris ====//
     fprintf( fp, "# Part 2 - facet list\n" );
     fprintf( fp, "%d 0\n", tri_cnt );
 
+    vector< SimpTri > allTriVec;
+    allTriVec.reserve( tri_cnt );
+    int pntOffset = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-            int ind1 = pntShift[i0] + 1;
-            int ind2 = pntShift[i1] + 1;
-            int ind3 = pntShift[i2] + 1;
-
-            fprintf( fp, "1\n" );
-            fprintf( fp, "3 %d %d %d\n", ind1, ind2, ind3 );
+            int i0 = indMap[ pntOffset + sTriVec[t].ind0 ];
+            int i1 = indMap[ pntOffset + sTriVec[t].ind1 ];
+            int i2 = indMap[ pntOffset + sTriVec[t].ind2 ];
+            SimpTri stri;
+            stri.ind0 = pntShift[i0] + 1;
+            stri.ind1 = pntShift[i1] + 1;
+            stri.ind2 = pntShift[i2] + 1;
+            allTriVec.push_back( stri );
         }
+        pntOffset += ( int )sPntVec.size();
     }
 
+    TetGenTriWriter tri_writer( allTriVec );
+    tri_writer.Write( fp, ( int )allTriVec.size() );
+
     fprintf( fp, "# Part 3 - Hole List\n" );
 
     vector<string> geomVec = m_Vehicle->GetGeomVec();
@@ -1552,12 +1815,12 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    vector< int > indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
     //==== Build Wake Map If Available ====//
-    map< int, vector< int > > wakeIndMap;
+    vector< int > wakeIndMap;
     vector< int > wakePntShift;
     int wakeNumPnts = 0;
     if ( wakeAllPntVec.size() )
@@ -1568,6 +1831,7 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //==== Assemble Normal Tris ====//
     vector< SimpTri > allTriVec;
     vector< int > allSurfIDVec;
+    int pntOffset = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if ( !m_SurfVec[i]->GetWakeFlag() )
@@ -1576,9 +1840,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+                int i0 = indMap[ pntOffset + sTriVec[t].ind0 ];
+                int i1 = indMap[ pntOffset + sTriVec[t].ind1 ];
+                int i2 = indMap[ pntOffset + sTriVec[t].ind2 ];
                 SimpTri stri;
                 stri.ind0 = pntShift[i0] + 1;
                 stri.ind1 = pntShift[i1] + 1;
@@ -1587,6 +1851,7 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
                 allTriVec.push_back( stri );
                 allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
             }
+            pntOffset += ( int )sPntVec.size();
         }
     }
     //==== Assemble All Used Points ====//
@@ -1601,6 +1866,7 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
 
     //==== Assemble Wake Tris ====//
     int wakeIndOffset = allUsedPntVec.size();
+    int wakePntOffset = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if ( m_SurfVec[i]->GetWakeFlag() )
@@ -1609,9 +1875,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], wakeAllPntVec, wakeIndMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], wakeAllPntVec, wakeIndMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], wakeAllPntVec, wakeIndMap );
+                int i0 = wakeIndMap[ wakePntOffset + sTriVec[t].ind0 ];
+                int i1 = wakeIndMap[ wakePntOffset + sTriVec[t].ind1 ];
+                int i2 = wakeIndMap[ wakePntOffset + sTriVec[t].ind2 ];
                 SimpTri stri;
                 stri.ind0 = wakePntShift[i0] + 1 + wakeIndOffset;
                 stri.ind1 = wakePntShift[i1] + 1 + wakeIndOffset;
@@ -1620,6 +1886,7 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
                 allTriVec.push_back( stri );
                 allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
             }
+            wakePntOffset += ( int )sPntVec.size();
         }
     }
 
@@ -1632,137 +1899,234 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         }
     }
 
-    //=====================================================================================//
-    //==== Write NASCART File =================================================================//
-    //=====================================================================================//
-    if ( dat_fn.length() != 0 )
+    //==== Formats Are Independent - Write Them Concurrently ====//
+    #pragma omp parallel sections
     {
-        FILE* fp = fopen( dat_fn.c_str(), "w" );
-
-        if ( fp )
+        #pragma omp section
         {
-            //===== Write Num Pnts and Tris ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
-
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            //=====================================================================================//
+            //==== Write NASCART File =================================================================//
+            //=====================================================================================//
+            if ( dat_fn.length() != 0 )
             {
-                fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
+                FILE* fp = OpenBufferedFile( dat_fn, "w" );
+
+                if ( fp )
+                {
+                    //===== Write Num Pnts and Tris ====//
+                    fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
+
+                    //==== Write Pnts ====//
+                    for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
+                    }
+
+                    //==== Write Tris ====//
+                    for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%d %d %d %d.0\n",
+                                 allTriVec[i].ind0, allTriVec[i].ind2, allTriVec[i].ind1,
+                                 SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
+                    }
+                    fclose( fp );
+                }
             }
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+            if ( key_fn.length() != 0 )
             {
-                fprintf( fp, "%d %d %d %d.0\n",
-                         allTriVec[i].ind0, allTriVec[i].ind2, allTriVec[i].ind1,
-                         SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
+                SubSurfaceMgr.WriteNascartKeyFile( key_fn );
             }
-            fclose( fp );
         }
-    }
 
-    if ( key_fn.length() != 0 )
-    {
-        SubSurfaceMgr.WriteNascartKeyFile( key_fn );
-    }
-
-    //=====================================================================================//
-    //==== Write OBJ File =================================================================//
-    //=====================================================================================//
-    if ( obj_fn.length() != 0 )
-    {
-        FILE* fp = fopen( obj_fn.c_str(), "w" );
-
-        if ( fp )
+        #pragma omp section
         {
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            //=====================================================================================//
+            //==== Write OBJ File =================================================================//
+            //=====================================================================================//
+            if ( obj_fn.length() != 0 )
             {
-                fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
-            fprintf( fp, "\n" );
+                FILE* fp = OpenBufferedFile( obj_fn, "w" );
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "f %d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
+                if ( fp )
+                {
+                    //==== Write Pnts ====//
+                    for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                    {
+                        fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
+                    }
+                    fprintf( fp, "\n" );
+
+                    //==== Write Tris ====//
+                    for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+                    {
+                        fprintf( fp, "f %d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
+                    }
+                    fclose( fp );
+                }
             }
-            fclose( fp );
         }
-    }
 
+        #pragma omp section
+        {
+            //=====================================================================================//
+            //==== Write TRI File for Cart3D ======================================================//
+            //=====================================================================================//
+            if ( tri_fn.length() != 0 )
+            {
+                FILE* fp = OpenBufferedFile( tri_fn, "w" );
 
-    //=====================================================================================//
-    //==== Write TRI File for Cart3D ======================================================//
-    //=====================================================================================//
-    if ( tri_fn.length() != 0 )
-    {
-        FILE* fp = fopen( tri_fn.c_str(), "w" );
+                if ( fp )
+                {
+                    //==== Write Pnt Count and Tri Count ====//
+                    fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
 
-        if ( fp )
-        {
-            //==== Write Pnt Count and Tri Count ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
+                    //==== Write Pnts ====//
+                    for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
+                    }
 
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+                    //==== Write Tris ====//
+                    for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
+                    }
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
+                    //==== Write Component ID ====//
+                    for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
+                    }
+
+                    fclose( fp );
+                }
             }
+        }
 
-            //==== Write Component ID ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+        #pragma omp section
+        {
+            //=====================================================================================//
+            //==== Write gmsh File           ======================================================//
+            //=====================================================================================//
+            if ( gmsh_fn.length() != 0 && GetCfdSettingsPtr()->m_GmshBinaryFlag )
             {
-                fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
+                WriteBinaryGmsh( gmsh_fn, allUsedPntVec, allTriVec );
             }
+            else if ( gmsh_fn.length() != 0 )
+            {
+                FILE* fp = OpenBufferedFile( gmsh_fn, "w" );
+                if ( fp )
+                {
+                    fprintf( fp, "$MeshFormat\n" );
+                    fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
+                    fprintf( fp, "$EndMeshFormat\n" );
+
+                    //==== Write Nodes ====//
+                    fprintf( fp, "$Nodes\n" );
+                    fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
+                    for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
+                                 allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
+                    }
+                    fprintf( fp, "$EndNodes\n" );
 
-            fclose( fp );
+                    //==== Write Tris ====//
+                    fprintf( fp, "$Elements\n" );
+                    fprintf( fp, "%d\n", ( int )allTriVec.size() );
+
+                    int ele_cnt = 1;
+                    for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
+                    {
+                        fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
+                        ele_cnt++;
+                    }
+
+                    fprintf( fp, "$EndElements\n" );
+                    fclose( fp );
+                }
+            }
         }
     }
+}
 
-    //=====================================================================================//
-    //==== Write gmsh File           ======================================================//
-    //=====================================================================================//
-    if ( gmsh_fn.length() != 0 )
+void CfdMeshMgrSingleton::WriteBinaryGmsh( const string &gmsh_fn, vector< vec3d* > &pnt_vec, vector< SimpTri > &tri_vec )
+{
+    FILE* fp = OpenBufferedFile( gmsh_fn, "wb" );
+    if ( !fp )
     {
-        FILE* fp = fopen( gmsh_fn.c_str(), "w" );
-        if ( fp )
-        {
-            fprintf( fp, "$MeshFormat\n" );
-            fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
-            fprintf( fp, "$EndMeshFormat\n" );
+        return;
+    }
 
-            //==== Write Nodes ====//
-            fprintf( fp, "$Nodes\n" );
-            fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
-                         allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
-            fprintf( fp, "$EndNodes\n" );
+    size_t npnt = pnt_vec.size();
+    size_t ntri = tri_vec.size();
+    int one = 1;
+    int dim = 2;
+    int ent_tag = 1;
+    int zero = 0;
+    int ele_type = 2; // 3-node triangle
 
-            //==== Write Tris ====//
-            fprintf( fp, "$Elements\n" );
-            fprintf( fp, "%d\n", ( int )allTriVec.size() );
+    //==== Format Header - Version 4.1, Binary, size_t Data Size ====//
+    fprintf( fp, "$MeshFormat\n" );
+    fprintf( fp, "4.1 1 %d\n", ( int )sizeof( size_t ) );
+    fwrite( &one, sizeof( int ), 1, fp );
+    fprintf( fp, "\n$EndMeshFormat\n" );
 
-            int ele_cnt = 1;
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-                ele_cnt++;
-            }
+    //==== Single Discrete Surface Entity ====//
+    BndBox box;
+    for ( int i = 0 ; i < ( int )npnt ; i++ )
+    {
+        box.Update( *pnt_vec[i] );
+    }
+    size_t ent_counts[4] = { 0, 0, 1, 0 };
+    double bounds[6] = { box.GetMin( 0 ), box.GetMin( 1 ), box.GetMin( 2 ),
+                         box.GetMax( 0 ), box.GetMax( 1 ), box.GetMax( 2 ) };
+    size_t no_tags = 0;
 
-            fprintf( fp, "$EndElements\n" );
-            fclose( fp );
-        }
+    fprintf( fp, "$Entities\n" );
+    fwrite( ent_counts, sizeof( size_t ), 4, fp );
+    fwrite( &ent_tag, sizeof( int ), 1, fp );
+    fwrite( bounds, sizeof( double ), 6, fp );
+    fwrite( &no_tags, sizeof( size_t ), 1, fp ); // Physical tags
+    fwrite( &no_tags, sizeof( size_t ), 1, fp ); // Bounding curves
+    fprintf( fp, "\n$EndEntities\n" );
+
+    //==== Write Nodes - One Block, Tags Then Coordinates ====//
+    size_t node_head[4] = { 1, npnt, 1, npnt };
+    fprintf( fp, "$Nodes\n" );
+    fwrite( node_head, sizeof( size_t ), 4, fp );
+    fwrite( &dim, sizeof( int ), 1, fp );
+    fwrite( &ent_tag, sizeof( int ), 1, fp );
+    fwrite( &zero, sizeof( int ), 1, fp ); // Not parametric
+    fwrite( &npnt, sizeof( size_t ), 1, fp );
+    for ( size_t i = 0 ; i < npnt ; i++ )
+    {
+        size_t tag = i + 1;
+        fwrite( &tag, sizeof( size_t ), 1, fp );
+    }
+    for ( size_t i = 0 ; i < npnt ; i++ )
+    {
+        fwrite( pnt_vec[i]->v, sizeof( double ), 3, fp );
     }
+    fprintf( fp, "\n$EndNodes\n" );
+
+    //==== Write Tris - Indices Are Already One Based ====//
+    size_t ele_head[4] = { 1, ntri, 1, ntri };
+    fprintf( fp, "$Elements\n" );
+    fwrite( ele_head, sizeof( size_t ), 4, fp );
+    fwrite( &dim, sizeof( int ), 1, fp );
+    fwrite( &ent_tag, sizeof( int ), 1, fp );
+    fwrite( &ele_type, sizeof( int ), 1, fp );
+    fwrite( &ntri, sizeof( size_t ), 1, fp );
+    for ( size_t i = 0 ; i < ntri ; i++ )
+    {
+        size_t ele[4] = { i + 1, ( size_t )tri_vec[i].ind0, ( size_t )tri_vec[i].ind1, ( size_t )tri_vec[i].ind2 };
+        fwrite( ele, sizeof( size_t ), 4, fp );
+    }
+    fprintf( fp, "\n$EndElements\n" );
+
+    fclose( fp );
 }
 
 void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
@@ -1784,12 +2148,13 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    vector< int > indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
     //==== Assemble Normal Tris ====//
     vector< SimpTri > allTriVec;
+    int pntOffset = 0;
     for ( int i = 0; i < (int)m_SurfVec.size(); i++ )
     {
         if ( !m_SurfVec[i]->GetWakeFlag() )
@@ -1798,9 +2163,9 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0; t < (int)sTriVec.size(); t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+                int i0 = indMap[ pntOffset + sTriVec[t].ind0 ];
+                int i1 = indMap[ pntOffset + sTriVec[t].ind1 ];
+                int i2 = indMap[ pntOffset + sTriVec[t].ind2 ];
                 SimpTri stri;
                 stri.ind0 = pntShift[i0] + 1;
                 stri.ind1 = pntShift[i1] + 1;
@@ -1808,6 +2173,7 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
                 stri.m_Tags = sTriVec[t].m_Tags;
                 allTriVec.push_back( stri );
             }
+            pntOffset += ( int )sPntVec.size();
         }
     }
     //==== Assemble All Used Points ====//
@@ -1825,7 +2191,7 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
     //=====================================================================================//
     if ( facet_fn.length() != 0 )
     {
-        FILE* fp = fopen( facet_fn.c_str(), "w" );
+        FILE* fp = OpenBufferedFile( facet_fn, "w" );
 
         if ( fp )
         {
@@ -1842,10 +2208,8 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
             fprintf( fp, "%d \n", (int)allUsedPntVec.size() ); // # of nodes in "Big" part
 
             //==== Write All Pnts (Nodes) ====//
-            for ( int i = 0; i < (int)allUsedPntVec.size(); i++ )
-            {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+            PntWriter pnt_writer( "%16.10g %16.10g %16.10g\n", allUsedPntVec );
+            pnt_writer.Write( fp, ( int )allUsedPntVec.size() );
 
             vector < int > tri_offset; // vector of number of tris for each tag
 
@@ -1853,20 +2217,25 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
 
             vector < int > all_tag_vec = SubSurfaceMgr.GetAllTags(); // vector of tags, where each tag identifies a part or group of facets
 
+            vector < int > tri_tag_vec( allTriVec.size() );
+            for ( unsigned int j = 0; j < allTriVec.size(); j++ )
+            {
+                tri_tag_vec[j] = SubSurfaceMgr.GetTag( allTriVec[j].m_Tags );
+            }
+
             //==== Get # of facets for each part ====//
+            vector < vector < int > > tag_tri_vec( all_tag_vec.size() );
             for ( unsigned int i = 0; i < all_tag_vec.size(); i++ )
             {
-                int tag_count = 0;
-
                 for ( unsigned int j = 0; j < allTriVec.size(); j++ )
                 {
-                    if ( all_tag_vec[i] == SubSurfaceMgr.GetTag( allTriVec[j].m_Tags ) )
+                    if ( all_tag_vec[i] == tri_tag_vec[j] )
                     {
-                        tag_count++;
+                        tag_tri_vec[i].push_back( j );
                     }
                 }
 
-                tri_offset.push_back( tag_count );
+                tri_offset.push_back( ( int )tag_tri_vec[i].size() );
             }
 
             fprintf( fp, "%ld \n", tri_offset.size() ); // # of "Small" parts
@@ -1876,28 +2245,21 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
                                  //==== Write Out Tris ====//
             for ( unsigned int i = 0; i < all_tag_vec.size(); i++ )
             {
-                int curr_tag = all_tag_vec[i];
-                bool new_section = true; // flag to write small part section header
-
-                for ( unsigned int j = 0; j < allTriVec.size(); j++ )
+                if ( tag_tri_vec[i].empty() )
                 {
-                    if ( curr_tag == SubSurfaceMgr.GetTag( allTriVec[j].m_Tags ) ) // only write out current tris for surrent tag
-                    {
-                        if ( new_section ) // write small part header and get material ID for small part
-                        {
-                            string name = SubSurfaceMgr.GetTagNames( allTriVec[j].m_Tags );
-                            fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
-                            fprintf( fp, "%d 3\n", tri_offset[i] ); // Number of facets for the part, 3 nodes per facet
+                    continue;
+                }
 
-                            new_section = false;
-                        }
+                // write small part header and get material ID for small part
+                string name = SubSurfaceMgr.GetTagNames( allTriVec[ tag_tri_vec[i][0] ].m_Tags );
+                fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
+                fprintf( fp, "%d 3\n", tri_offset[i] ); // Number of facets for the part, 3 nodes per facet
 
-                        facet_count++;
+                // 3 nodes of facet, material ID, component ID, running facet #:
+                FacetTriWriter tri_writer( allTriVec, tag_tri_vec[i], materialID, i + 1, facet_count );
+                tri_writer.Write( fp, ( int )tag_tri_vec[i].size() );
 
-                        // 3 nodes of facet, material ID, component ID, running facet #:
-                        fprintf( fp, "%d %d %d %d %d %d\n", allTriVec[j].ind0, allTriVec[j].ind1, allTriVec[j].ind2, materialID, i + 1, facet_count );
-                    }
-                }
+                facet_count += ( int )tag_tri_vec[i].size();
             }
             fclose( fp );
         }
@@ -1924,7 +2286,7 @@ string CfdMeshMgrSingleton::CheckWaterTight()
     }
 
     //==== Build Map ====//
-    map< int, vector< int > > indMap;
+    vector< int > indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
@@ -1942,6 +2304,7 @@ string CfdMeshMgrSingleton::CheckWaterTight()
     //==== Create Edges and Tris ====//
     int moreThanTwoTriPerEdge = 0;
     map< int, vector<Edge*> > edgeMap;
+    int pntOffset = 0;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || m_SurfVec[i]->GetFarFlag() || m_SurfVec[i]->GetSymPlaneFlag() )
@@ -1950,9 +2313,9 @@ string CfdMeshMgrSingleton::CheckWaterTight()
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
+                int i0 = indMap[ pntOffset + sTriVec[t].ind0 ];
+                int i1 = indMap[ pntOffset + sTriVec[t].ind1 ];
+                int i2 = indMap[ pntOffset + sTriVec[t].ind2 ];
                 int ind1 = pntShift[i0];
                 int ind2 = pntShift[i1];
                 int ind3 = pntShift[i2];
@@ -1985,6 +2348,7 @@ string CfdMeshMgrSingleton::CheckWaterTight()
                     m_BadTris.push_back( tri );
                 }
             }
+            pntOffset += ( int )sPntVec.size();
         }
     }
 
@@ -2066,94 +2430,48 @@ Edge* CfdMeshMgrSingleton::FindAddEdge( map< int, vector<Edge*> > & edgeMap, vec
     return e;
 }
 
-int CfdMeshMgrSingleton::BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift )
+int CfdMeshMgrSingleton::BuildIndMap( vector< vec3d* > & allPntVec, vector< int > & indMap, vector< int > & pntShift )
 {
-//double max_dist = 0.0;
+    // Group coincident points in a single pass.  indMap is filled with the index of the
+    // first point (in allPntVec order) of each group and pntShift numbers those first
+    // points consecutively.  Non-first points get a pntShift of -999.
     double tol = 1.0e-12;
-    map<int, vector<int> >::const_iterator iter;
+
+    //==== Build Map ====//
+    PntNodeCloud pnCloud;
+    pnCloud.ReserveMorePntNodes( allPntVec.size() );
     for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
     {
-        int combind = ( int )( ( allPntVec[i]->x() + allPntVec[i]->y() + allPntVec[i]->z() ) * 10000.0 );
-        iter = indMap.find( combind );
-        if ( iter == indMap.end() ) // Add Index
-        {
-            indMap[combind].push_back( i );
-        }
-        else
-        {
-            bool addIndexFlag = true;
-            for ( int j = 0 ; j < ( int )iter->second.size() ; j++ )
-            {
-                int testind = iter->second[j];
-
-                if ( std::abs( allPntVec[i]->x() - allPntVec[testind]->x() ) < tol  &&
-                        std::abs( allPntVec[i]->y() - allPntVec[testind]->y() ) < tol  &&
-                        std::abs( allPntVec[i]->z() - allPntVec[testind]->z() ) < tol  )
-                {
-                    addIndexFlag = false;
-                }
-            }
-            if ( addIndexFlag )
-            {
-                indMap[combind].push_back( i );
-            }
-        }
+        pnCloud.AddPntNode( *allPntVec[i] );
     }
 
-    //==== Figure Out Point Shifts ====//
+    indMap.resize( allPntVec.size() );
     pntShift.resize( allPntVec.size() );
-    for ( int i = 0 ; i < ( int )pntShift.size() ; i++ )
-    {
-        pntShift[i] = -999;
-    }
 
-    for ( iter = indMap.begin() ; iter != indMap.end() ; iter++ )
+    if ( allPntVec.size() == 0 )
     {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
-        {
-            int ind = iter->second[i];
-            pntShift[ind] = 1;
-        }
+        return 0;
     }
 
-    int cnt = 0;
-    for ( int i = 0 ; i < ( int )pntShift.size() ; i++ )
+    //==== Use NanoFlann to Find Close Points and Group - Search Radius Is Squared ====//
+    IndexPntNodes( pnCloud, tol * tol );
+
+    //==== Figure Out Point Shifts ====//
+    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
     {
-        if ( pntShift[i] > 0 )
+        indMap[i] = pnCloud.GetNodeBaseIndex( i );
+
+        if ( pnCloud.UsedNode( i ) )
         {
-            pntShift[i] = cnt;
-            cnt++;
+            pntShift[i] = pnCloud.GetNodeUsedIndex( i );
         }
-    }
-
-    return cnt;
-
-}
-
-int  CfdMeshMgrSingleton::FindPntIndex(  vec3d& pnt, vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap )
-{
-    double tol = 1.0e-12;
-    map<int, vector<int> >::const_iterator iter;
-
-    int combind = ( int )( ( pnt.x() + pnt.y() + pnt.z() ) * 10000.0 );
-    iter = indMap.find( combind );
-    if ( iter != indMap.end() )
-    {
-        for ( int j = 0 ; j < ( int )iter->second.size() ; j++ )
+        else
         {
-            int testind = iter->second[j];
-
-            if ( std::abs( pnt.x() - allPntVec[testind]->x() ) < tol  &&
-                    std::abs( pnt.y() - allPntVec[testind]->y() ) < tol  &&
-                    std::abs( pnt.z() - allPntVec[testind]->z() ) < tol  )
-            {
-                return testind;
-            }
+            pntShift[i] = -999;
         }
     }
 
-    printf( "Error: CfdMeshMgr.FindPntIndex can't find index\n" );
-    return 0;
+    return pnCloud.m_NumUsedPts;
 }
 
 vector< Surf* > CfdMeshMgrSingleton::CreateDomainSurfs()
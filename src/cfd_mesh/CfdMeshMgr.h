@@ -163,6 +163,16 @@ protected:
 
 };
 
+//==== Remeshed Surface Kept So An Unchanged Surface Can Skip Remesh ====//
+struct SurfRemeshRecord
+{
+    vector< double > m_Key;
+    vector< SimpTri > m_SimpTriVec;
+    vector< vec3d > m_SimpPntVec;
+    vector< vec2d > m_SimpUWPntVec;
+    int m_NumRevRemoved;
+};
+
 //////////////////////////////////////////////////////////////////////
 class CfdMeshMgrSingleton : public SurfaceIntersectionSingleton
 {
@@ -242,15 +252,15 @@ public:
 
     virtual void WriteSTL( const string &filename );
     virtual void WriteTaggedSTL( const string &filename );
+    virtual void WriteBinarySTL( const string &filename );
+    virtual void WriteBinaryGmsh( const string &gmsh_fn, vector< vec3d* > &pnt_vec, vector< SimpTri > &tri_vec );
     virtual void WriteTetGen( const string &filename );
     virtual void WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn );
     virtual void WriteFacet( const string &facet_fn );
 
     void ExportFiles() override;
     //virtual void CheckDupOrAdd( Node* node, vector< Node* > & nodeVec );
-    virtual int BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift );
-    virtual int  FindPntIndex( vec3d& pnt, vector< vec3d* > & allPntVec,
-                               map< int, vector< int > >& indMap );
+    virtual int BuildIndMap( vector< vec3d* > & allPntVec, vector< int > & indMap, vector< int > & pntShift );
 
     virtual string CheckWaterTight();
     virtual Edge* FindAddEdge( map< int, vector<Edge*> > & edgeMap, vector< Node* > & nodeVec, int ind1, int ind2 );
@@ -327,6 +337,9 @@ protected:
 
     BndBox m_Domain;
 
+    //==== Remeshed Surfaces From The Last Run Keyed By Remesh Input Hash ====//
+    map< size_t, SurfRemeshRecord > m_RemeshCache;
+
     vector< vector< vec3d > > debugRayIsect;
 
     vector<Edge*> m_BadEdges;
@@ -965,7 +965,7 @@ void FeaMeshMgrSingleton::BuildFeaMesh()
                     break;
                 }
 
-                // Use node point if close to beam endpoints (avoids tolerance errors in BuildIndMap and FindPntInd)
+                // Use node point if close to beam endpoints (avoids tolerance errors in BuildIndMap)
                 for ( size_t k = 0; k < node_vec.size(); k++ )
                 {
                     if ( dist( node_vec[k], start_pnt ) <= FLT_EPSILON )
@@ -2061,8 +2061,12 @@ void FeaMeshMgrSingleton::TagFeaNodes()
     //==== Collect All FeaNodes ====//
     m_FeaNodeVec.clear();
 
+    // Index of each element's first node in m_FeaNodeVec
+    vector< int > elem_node_offset( m_FeaElementVec.size() );
+
     for ( int i = 0; i < (int)m_FeaElementVec.size(); i++ )
     {
+        elem_node_offset[i] = (int)m_FeaNodeVec.size();
         m_FeaElementVec[i]->LoadNodes( m_FeaNodeVec );
     }
 
@@ -2081,47 +2085,41 @@ void FeaMeshMgrSingleton::TagFeaNodes()
     for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
     {
         m_FeaNodeVec[i]->m_Tags.clear();
-        int ind = FindPntIndex( m_FeaNodeVec[i]->m_Pnt, m_AllPntVec, m_IndMap );
+        int ind = m_IndMap[i];
         m_FeaNodeVec[i]->m_Index = m_PntShift[ind] + 1;
     }
 
-    // Tag FeaPart Nodes with FeaPart Index
-    for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
+    // Tag FeaPart Nodes with FeaPart Index and FeaSubSurface Nodes with FeaSubSurface Index,
+    // beginning at the last FeaPart index (m_NumFeaParts)
+    for ( int j = 0; j < (int)m_FeaElementVec.size(); j++ )
     {
-        vector< FeaNode* > temp_nVec;
+        int part_ind = m_FeaElementVec[j]->GetFeaPartIndex();
+        int ss_ind = m_FeaElementVec[j]->GetFeaSSIndex();
+        int tag = -1;
 
-        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+        if ( ss_ind < 0 )
         {
-            if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
+            if ( part_ind >= 0 && part_ind < (int)m_NumFeaParts )
             {
-                m_FeaElementVec[j]->LoadNodes( temp_nVec );
+                tag = part_ind;
             }
         }
-
-        for ( int j = 0; j < (int)temp_nVec.size(); j++ )
+        else if ( ss_ind < (int)m_NumFeaSubSurfs && m_SimpleSubSurfaceVec[ss_ind].m_IncludedElements != vsp::FEA_BEAM )
         {
-            int ind = FindPntIndex( temp_nVec[j]->m_Pnt, m_AllPntVec, m_IndMap );
-            m_FeaNodeVec[ind]->AddTag( i );
+            tag = ss_ind + m_NumFeaParts;
         }
-    }
 
-    // Tag FeaSubSurface Nodes with FeaSubSurface Index, beginning at the last FeaPart index (m_NumFeaParts)
-    for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
-    {
-        vector< FeaNode* > temp_nVec;
-
-        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+        if ( tag < 0 )
         {
-            if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() >= 0 && m_SimpleSubSurfaceVec[i].m_IncludedElements != vsp::FEA_BEAM )
-            {
-                m_FeaElementVec[j]->LoadNodes( temp_nVec );
-            }
+            continue;
         }
 
-        for ( int j = 0; j < (int)temp_nVec.size(); j++ )
+        int num_nodes = (int)m_FeaElementVec[j]->m_Corners.size() + (int)m_FeaElementVec[j]->m_Mids.size();
+
+        for ( int k = 0; k < num_nodes; k++ )
         {
-            int ind = FindPntIndex( temp_nVec[j]->m_Pnt, m_AllPntVec, m_IndMap );
-            m_FeaNodeVec[ind]->AddTag( i + m_NumFeaParts );
+            int ind = m_IndMap[elem_node_offset[j] + k];
+            m_FeaNodeVec[ind]->AddTag( tag );
         }
     }
 
@@ -2145,7 +2143,7 @@ void FeaMeshMgrSingleton::TagFeaNodes()
                         mass->Create( m_FeaNodeVec[i]->m_Pnt, m_FixPointMassMap[j][k] );
                         mass->SetFeaPartIndex( m_FixPntFeaPartIndexMap[j][k] );
 
-                        int ind = FindPntIndex( m_FeaNodeVec[i]->m_Pnt, m_AllPntVec, m_IndMap );
+                        int ind = m_IndMap[i];
                         mass->m_Corners[0]->m_Index = m_PntShift[ind] + 1;
 
                         m_FeaElementVec.push_back( mass );
@@ -197,7 +197,7 @@ protected:
 
     vector< FeaNode* > m_FeaNodeVec;
     vector< vec3d* > m_AllPntVec;
-    map< int, vector< int > > m_IndMap;
+    vector< int > m_IndMap;
     vector< int > m_PntShift;
 
     SimpleFeaMeshSettings m_StructSettings;
@@ -122,4 +122,64 @@ struct MSCloud
     }
 };
 
+// Result set for growth limiting a target map point against the sources of all other surfaces.
+// Rather than storing matches, it keeps the smallest limited strength found and skips sources
+// from the excluded surface.  This allows a single tree over every surface's sources to be
+// shared by all surfaces.  The search radius shrinks as the limit tightens, since sources
+// farther away than ( str - minstr ) / grm1 can not reduce it further.
+
+struct MSLimitResultSet
+{
+    MSLimitResultSet( const MSCloud & cloud, double str, double minstr, double grm1, int exclude_surfid ) :
+        m_Cloud( cloud )
+    {
+        m_Str = str;
+        m_MinStr = minstr;
+        m_Grm1 = grm1;
+        m_ExcludeSurfID = exclude_surfid;
+        UpdateRadius();
+    }
+
+    inline bool full() const
+    {
+        return true;
+    }
+
+    inline double worstDist() const
+    {
+        return m_Radius;
+    }
+
+    inline void addPoint( double dist, size_t index )
+    {
+        if ( dist < m_Radius )
+        {
+            const MapSource* ms = m_Cloud.sources[index];
+            if ( ms->m_surfid != m_ExcludeSurfID )
+            {
+                double ts = ms->m_str + m_Grm1 * sqrt( dist );
+                if ( ts < m_Str )
+                {
+                    m_Str = ts;
+                    UpdateRadius();
+                }
+            }
+        }
+    }
+
+    inline void UpdateRadius()
+    {
+        double rmax = ( m_Str - m_MinStr ) / m_Grm1;
+        // Pad to keep sources at the round-off boundary.
+        m_Radius = rmax > 0.0 ? rmax * rmax * ( 1.0 + 1.0e-10 ) : 0.0;
+    }
+
+    const MSCloud & m_Cloud;
+    double m_Str;
+    double m_MinStr;
+    double m_Grm1;
+    double m_Radius;
+    int m_ExcludeSurfID;
+};
+
 #endif
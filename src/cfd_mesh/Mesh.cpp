@@ -226,6 +226,68 @@ void Mesh::Remesh()
 
 }
 
+//==== Everything Remesh Reads - Initial Mesh, Surface, Target Map, And Grid Settings ====//
+void Mesh::GetRemeshInputKey( vector< double > & key )
+{
+    key.clear();
+
+    const vector< double > & geom_key = m_Surf->GetGeomKey();
+    key.insert( key.end(), geom_key.begin(), geom_key.end() );
+    m_Surf->GetTargetMapKey( key );
+    key.push_back( m_Surf->GetFlipFlag() );
+    key.push_back( m_GridDensity->m_GrowRatio );
+    key.push_back( m_GridDensity->m_MinLen );
+
+    map< Node*, int > node_ind_map;
+    map< Edge*, int > edge_ind_map;
+
+    list< Node* >::iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    {
+        int ind = ( int )node_ind_map.size();
+        node_ind_map[ *n ] = ind;
+    }
+
+    list< Edge* >::iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    {
+        int ind = ( int )edge_ind_map.size();
+        edge_ind_map[ *e ] = ind;
+
+        key.push_back( node_ind_map[ ( *e )->n0 ] );
+        key.push_back( node_ind_map[ ( *e )->n1 ] );
+        key.push_back( ( *e )->border );
+        key.push_back( ( *e )->ridge );
+    }
+
+    //==== Node Edge Order Drives Target Length Limiting ====//
+    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    {
+        key.push_back( ( *n )->pnt.x() );
+        key.push_back( ( *n )->pnt.y() );
+        key.push_back( ( *n )->pnt.z() );
+        key.push_back( ( *n )->uw.x() );
+        key.push_back( ( *n )->uw.y() );
+        key.push_back( ( *n )->fixed );
+
+        for ( int i = 0 ; i < ( int )( *n )->edgeVec.size() ; i++ )
+        {
+            key.push_back( edge_ind_map[ ( *n )->edgeVec[i] ] );
+        }
+    }
+
+    list< Tri* >::iterator t;
+    for ( t = triList.begin() ; t != triList.end(); t++ )
+    {
+        key.push_back( node_ind_map[ ( *t )->n0 ] );
+        key.push_back( node_ind_map[ ( *t )->n1 ] );
+        key.push_back( node_ind_map[ ( *t )->n2 ] );
+        key.push_back( edge_ind_map[ ( *t )->e0 ] );
+        key.push_back( edge_ind_map[ ( *t )->e1 ] );
+        key.push_back( edge_ind_map[ ( *t )->e2 ] );
+    }
+}
+
 void Mesh::LoadSimpTris()
 {
     list< Tri* >::iterator t;
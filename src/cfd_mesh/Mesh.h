@@ -160,6 +160,8 @@ public:
 
     void StretchSimpPnts( double start_x, double end_x, double factor, double angle );
 
+    void GetRemeshInputKey( vector< double > & key );
+
     void RemoveInteriorTrisEdgesNodes();
 
     int GetNumFixPointIter()
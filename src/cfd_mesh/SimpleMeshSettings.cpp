@@ -158,6 +158,9 @@ void SimpleCfdMeshSettings::CopyFrom( CfdMeshSettings* settings )
 
     m_XYZIntCurveFlag = settings->m_XYZIntCurveFlag.Get();
 
+    m_STLBinaryFlag = settings->m_STLBinaryFlag.Get();
+    m_GmshBinaryFlag = settings->m_GmshBinaryFlag.Get();
+
     m_ExportFileNames = settings->GetExportFileNames();
 
     SimpleMeshCommonSettings::CopyFrom( settings );
@@ -238,7 +241,7 @@ bool SimpleFeaMeshSettings::GetExportFileFlag( int type )
 
 SimpleGridDensity::SimpleGridDensity()
 {
-
+    ClearSourceIndex();
 }
 
 SimpleGridDensity::~SimpleGridDensity()
@@ -258,6 +261,7 @@ void SimpleGridDensity::CopyFrom( GridDensity* gd )
     m_FarMaxGap = gd->m_FarMaxGap.Get();
     m_GrowRatio = gd->m_GrowRatio.Get();
     m_Sources = gd->GetSimpleSourceVec();
+    ClearSourceIndex();
 }
 
 double SimpleGridDensity::GetRadFrac( bool farflag )
@@ -314,17 +318,155 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     }
     base_len = target_len;
 
-    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    if ( !m_SourceIndexFlag )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        for ( int i = 0; i < (int)m_Sources.size(); i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    for ( int i = 0; i < (int)m_UnboundedSourceVec.size(); i++ )
+    {
+        double len = m_Sources[ m_UnboundedSourceVec[i] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
         if ( len < target_len )
         {
             target_len = len;
         }
     }
+
+    int cell = FindSourceCell( pos );
+    if ( cell >= 0 )
+    {
+        const vector< int > & cell_sources = m_CellSourceVec[cell];
+        for ( int i = 0; i < (int)cell_sources.size(); i++ )
+        {
+            double len = m_Sources[ cell_sources[i] ]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+    }
     return target_len;
 }
 
+void SimpleGridDensity::ClearSourceIndex()
+{
+    m_SourceIndexFlag = false;
+    m_SourceIndexBox.Reset();
+    for ( int k = 0; k < 3; k++ )
+    {
+        m_NumCells[k] = 0;
+        m_CellScale[k] = 0.0;
+    }
+    m_CellSourceVec.clear();
+    m_UnboundedSourceVec.clear();
+}
+
+void SimpleGridDensity::BuildSourceIndex()
+{
+    ClearSourceIndex();
+
+    vector< BndBox > box_vec( m_Sources.size() );
+    vector< bool > bound_vec( m_Sources.size(), false );
+    int nbound = 0;
+
+    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    {
+        if ( m_Sources[i]->GetInfluenceBox( box_vec[i] ) )
+        {
+            // Pad slightly so round-off at the edge of influence can not cull a source.
+            box_vec[i].Expand( 1.0e-10 * max( 1.0, box_vec[i].GetLargestDist() ) );
+            m_SourceIndexBox.Update( box_vec[i] );
+            bound_vec[i] = true;
+            nbound++;
+        }
+        else
+        {
+            m_UnboundedSourceVec.push_back( i );
+        }
+    }
+
+    if ( nbound > 0 )
+    {
+        //==== Size Cells For A Few Sources Per Cell ====//
+        int max_cells_per_dir = 64;
+        double target_cells = 4.0 * nbound;
+
+        double min_ext = 1.0e-6 * max( 1.0, m_SourceIndexBox.GetLargestDist() );
+        double ext[3];
+        for ( int k = 0; k < 3; k++ )
+        {
+            ext[k] = max( min_ext, m_SourceIndexBox.GetMax( k ) - m_SourceIndexBox.GetMin( k ) );
+        }
+
+        double cell_size = pow( ext[0] * ext[1] * ext[2] / target_cells, 1.0 / 3.0 );
+
+        for ( int k = 0; k < 3; k++ )
+        {
+            m_NumCells[k] = ( int )( ext[k] / cell_size + 0.5 );
+            m_NumCells[k] = max( 1, min( max_cells_per_dir, m_NumCells[k] ) );
+            m_CellScale[k] = m_NumCells[k] / ext[k];
+        }
+
+        m_CellSourceVec.resize( m_NumCells[0] * m_NumCells[1] * m_NumCells[2] );
+
+        //==== Bin Sources Into Every Cell Their Box Overlaps ====//
+        for ( int i = 0; i < (int)m_Sources.size(); i++ )
+        {
+            if ( !bound_vec[i] )
+            {
+                continue;
+            }
+
+            int imin[3], imax[3];
+            for ( int k = 0; k < 3; k++ )
+            {
+                imin[k] = ( int )( ( box_vec[i].GetMin( k ) - m_SourceIndexBox.GetMin( k ) ) * m_CellScale[k] );
+                imax[k] = ( int )( ( box_vec[i].GetMax( k ) - m_SourceIndexBox.GetMin( k ) ) * m_CellScale[k] );
+                imin[k] = max( 0, min( m_NumCells[k] - 1, imin[k] ) );
+                imax[k] = max( 0, min( m_NumCells[k] - 1, imax[k] ) );
+            }
+
+            for ( int ii = imin[0]; ii <= imax[0]; ii++ )
+            {
+                for ( int jj = imin[1]; jj <= imax[1]; jj++ )
+                {
+                    for ( int kk = imin[2]; kk <= imax[2]; kk++ )
+                    {
+                        m_CellSourceVec[ ( ii * m_NumCells[1] + jj ) * m_NumCells[2] + kk ].push_back( i );
+                    }
+                }
+            }
+        }
+    }
+
+    m_SourceIndexFlag = true;
+}
+
+int SimpleGridDensity::FindSourceCell( const vec3d & pos )
+{
+    if ( m_CellSourceVec.empty() || !m_SourceIndexBox.CheckPnt( pos ) )
+    {
+        return -1;
+    }
+
+    int ind[3];
+    for ( int k = 0; k < 3; k++ )
+    {
+        ind[k] = ( int )( ( pos[k] - m_SourceIndexBox.GetMin( k ) ) * m_CellScale[k] );
+        ind[k] = max( 0, min( m_NumCells[k] - 1, ind[k] ) );
+    }
+
+    return ( ind[0] * m_NumCells[1] + ind[1] ) * m_NumCells[2] + ind[2];
+}
+
 void SimpleGridDensity::ScaleAllSources( double scale )
 {
     for ( int i = 0; i < (int)m_Sources.size(); i++ )
@@ -114,6 +114,9 @@ public:
 
     vector < bool > m_ExportFileFlags;
 
+    bool m_STLBinaryFlag;
+    bool m_GmshBinaryFlag;
+
 protected:
 
     vector < string > m_ExportFileNames;
@@ -182,16 +185,24 @@ public:
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        ClearSourceIndex();
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        ClearSourceIndex();
     }
     int  GetNumSources()
     {
         return m_Sources.size();
     }
 
+    // Bin sources by their influence box so GetTargetLen only evaluates sources that can
+    // affect the query point.  Must be rebuilt after sources move; adding or clearing
+    // sources drops the index and GetTargetLen falls back to checking every source.
+    void BuildSourceIndex();
+    void ClearSourceIndex();
+
     void ScaleAllSources( double scale );
 
     void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -210,8 +221,18 @@ public:
 
 protected:
 
+    int FindSourceCell( const vec3d & pos );
+
     vector< BaseSimpleSource* > m_Sources;
 
+    //==== Uniform Grid of Source Indices ====//
+    bool m_SourceIndexFlag;
+    BndBox m_SourceIndexBox;
+    int m_NumCells[3];
+    double m_CellScale[3];
+    vector< vector< int > > m_CellSourceVec;
+    vector< int > m_UnboundedSourceVec;         // Sources without an influence box, always evaluated
+
 };
 
 class SimpleCfdGridDensity : public SimpleGridDensity
@@ -33,6 +33,7 @@ Surf::Surf()
     m_BaseTag = 1;
     m_MainSurfID = 0;
     m_FeaPartIndex = -1;
+    m_GeomHash = 0;
 }
 
 Surf::~Surf()
@@ -125,7 +126,7 @@ double Surf::TargetLen( double u, double w, double gap, double radfrac )
     return len;
 }
 
-void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
+void Surf::BuildTargetMap( int sid )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
     int npatchw = m_SurfCore.GetNumWPatches();
@@ -187,6 +188,16 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
 
             MapSource ms = MapSource( p, len, sid );
             m_SrcMap[i][j] = ms;
+        }
+    }
+}
+
+void Surf::LoadTargetMapSources( vector< MapSource* > &sources )
+{
+    for( int i = 0; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        for( int j = 0; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
             sources.push_back( &( m_SrcMap[i][j] ) );
         }
     }
@@ -359,11 +370,11 @@ void Surf::LimitTargetMap()
     }
 }
 
-void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
+void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap, int sid )
 {
     double grm1 = m_GridDensityPtr->m_GrowRatio - 1.0;
 
-    double tmin = min( minmap, es_cloud.sources[0]->m_str );
+    double tmin = minmap;
 
     SearchParams params;
     params.sorted = false;
@@ -371,44 +382,74 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
     int nmapu = m_SrcMap.size();
     int nmapw = m_SrcMap[0].size();
 
-    // Loop over surface evaluating source strength and curvature
+    // Find the limit imposed by other surfaces on each map point.  Sources on this surface are
+    // excluded, so the searches do not depend on each other and can run concurrently.
+    vector< vector< double > > tlim( nmapu, vector< double >( nmapw ) );
+
+    #pragma omp parallel for schedule( dynamic )
     for( int i = 0; i < nmapu ; i++ )
     {
-//      double u = ( 1.0 * i ) / ( m_NumMap - 1 );
         for( int j = 0; j < nmapw ; j++ )
         {
-//          double w = ( 1.0 * j ) / ( m_NumMap - 1 );
-
             double *query_pt = m_SrcMap[i][j].m_pt.v;
 
             double t = m_SrcMap[i][j].m_str;
-            double torig = t;
 
             double rmax = ( t - tmin ) / grm1;
             if( rmax > 0.0 )
             {
-                double r2max = rmax * rmax;
+                MSLimitResultSet es_result( es_cloud, t, tmin, grm1, sid );
+                es_tree.findNeighbors( es_result, query_pt, params );
+                t = es_result.m_Str;
+            }
+            tlim[i][j] = t;
+        }
+    }
 
-                MSTreeResults es_matches;
+    // Apply limits in map order.  Walking a reduced point may lower points visited later; that
+    // only shrinks their search radius, which can not change the limit found above.
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            double torig = m_SrcMap[i][j].m_str;
+            double t = min( torig, tlim[i][j] );
+
+            if( t < torig )
+            {
+                m_SrcMap[i][j].m_str = t;
+                WalkMap( i, j );
+            }
+        }
+    }
+}
 
-                int nMatches = es_tree.radiusSearch( query_pt, r2max, es_matches, params );
+double Surf::GetMinTargetMap()
+{
+    double minmap = numeric_limits<double>::max( );
 
-                for ( int k = 0; k < nMatches; k++ )
-                {
-                    int imatch = es_matches[k].first;
-                    double r = sqrt( es_matches[k].second );
+    for( int i = 0; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        for( int j = 0; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            minmap = min( minmap, m_SrcMap[i][j].m_str );
+        }
+    }
+    return minmap;
+}
 
-                    double str = es_cloud.sources[imatch]->m_str;
+//==== Target Map Strengths - Captures Sources And Limiting ====//
+void Surf::GetTargetMapKey( vector< double > & key )
+{
+    key.push_back( m_NumMap );
+    key.push_back( m_SrcMap.size() );
 
-                    double ts = str + grm1 * r;
-                    t = min( t, ts );
-                }
-                if( t < torig )
-                {
-                    m_SrcMap[i][j].m_str = t;
-                    WalkMap( i, j );
-                }
-            }
+    for( int i = 0; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        key.push_back( m_SrcMap[i].size() );
+        for( int j = 0; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            key.push_back( m_SrcMap[i][j].m_str );
         }
     }
 }
@@ -641,8 +682,6 @@ void Surf::WriteSTL( const char* filename )
 
 void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
 {
-    int i;
-
     if ( surfPtr->GetCompID() == m_CompID )
     {
         return;
@@ -661,8 +700,13 @@ void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
         return;
     }
 
+    MeshMgr->IntersectSurfPatches( this, surfPtr );
+}
+
+void Surf::IntersectPatches( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
+{
     vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
         if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
         {
             for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
@@ -60,12 +60,15 @@ public:
     }
 
     double TargetLen( double u, double w, double gap, double radfrac );
-    void BuildTargetMap( vector< MapSource* > &sources, int sid );
+    void BuildTargetMap( int sid );
+    void LoadTargetMapSources( vector< MapSource* > &sources );
     void WalkMap( int istart, int jstart, int kstart );
     void WalkMap( int istart, int jstart );
     void LimitTargetMap();
-    void LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap );
+    void LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap, int sid );
     double InterpTargetMap( double u, double w );
+    double GetMinTargetMap();
+    void GetTargetMapKey( vector< double > & key );
     void UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj );
     void UWtoTargetMapij( double u, double w, int &i, int &j );
 
@@ -140,6 +143,20 @@ public:
         return m_FeaPartIndex;
     }
 
+    void SetGeomKey( const vector< double > & key )
+    {
+        m_GeomKey = key;
+        m_GeomHash = HashKey( key );
+    }
+    const vector< double > & GetGeomKey()
+    {
+        return m_GeomKey;
+    }
+    size_t GetGeomHash()
+    {
+        return m_GeomHash;
+    }
+
     void Draw();
 
     void LoadSCurves( vector< SCurve* > & scurve_vec );
@@ -153,6 +170,7 @@ public:
     }
 
     void Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    void IntersectPatches( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
@@ -292,6 +310,9 @@ protected:
 
     int m_FeaPartIndex;
 
+    vector< double > m_GeomKey;
+    size_t m_GeomHash;
+
 };
 
 
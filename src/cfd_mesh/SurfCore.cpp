@@ -749,6 +749,44 @@ void SurfCore::BuildPatches( Surf* srf ) const
     srf->SetPatchVec( patchVec );
 }
 
+//==== Patch Layout, Parameterization, And Control Points ====//
+void SurfCore::GetGeomKey( vector< double > & key ) const
+{
+    key.push_back( m_Surface.number_u_patches() );
+    key.push_back( m_Surface.number_v_patches() );
+
+    for ( int ip = 0; ip < m_Surface.number_u_patches(); ip++ )
+    {
+        for ( int jp = 0; jp < m_Surface.number_v_patches(); jp++ )
+        {
+            double umin, du, vmin, dv;
+            const surface_patch_type *epatch = m_Surface.get_patch( ip, jp, umin, du, vmin, dv );
+
+            key.push_back( umin );
+            key.push_back( du );
+            key.push_back( vmin );
+            key.push_back( dv );
+
+            int nu = ( int )epatch->degree_u();
+            int nv = ( int )epatch->degree_v();
+
+            key.push_back( nu );
+            key.push_back( nv );
+
+            for ( int i = 0; i <= nu; i++ )
+            {
+                for ( int j = 0; j <= nv; j++ )
+                {
+                    surface_point_type cp = epatch->get_control_point( i, j );
+                    key.push_back( cp.x() );
+                    key.push_back( cp.y() );
+                    key.push_back( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 double SurfCore::FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0 ) const
 {
     double dist;
@@ -23,11 +23,23 @@ typedef piecewise_surface_type::point_type surface_point_type;
 typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
 
 #include <vector>
+#include <functional>
 using std::vector;
 
 class Bezier_curve;
 class Surf;
 
+//==== Hash A Cache Key - Cache Entries Keep The Full Key And Compare It On A Hit ====//
+inline size_t HashKey( const vector< double > & key )
+{
+    size_t seed = key.size();
+    for ( int i = 0 ; i < ( int )key.size() ; i++ )
+    {
+        seed ^= std::hash< double >()( key[i] ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    }
+    return seed;
+}
+
 //////////////////////////////////////////////////////////////////////
 class SurfCore
 {
@@ -112,6 +124,8 @@ public:
 
     void BuildPatches( Surf* srf ) const;
 
+    void GetGeomKey( vector< double > & key ) const;
+
     double FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0 ) const;
     double FindNearest( double &u, double &w, const vec3d &pt ) const;
 
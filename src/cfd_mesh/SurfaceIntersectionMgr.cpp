@@ -33,6 +33,8 @@ SurfaceIntersectionSingleton::SurfaceIntersectionSingleton() : ParmContainer()
 
     m_MeshInProgress = false;
 
+    m_ISegRecordVec = NULL;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
     _mkdir( m_DebugDir.get_char_star() );
@@ -767,7 +769,15 @@ void SurfaceIntersectionSingleton::Intersect()
 
     if ( GetSettingsPtr()->m_IntersectSubSurfs ) BuildSubSurfIntChains();
 
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        vector< double > key;
+        m_SurfVec[i]->GetSurfCore()->GetGeomKey( key );
+        m_SurfVec[i]->SetGeomKey( key );
+    }
+
     //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
+    m_NewISegCache.clear();
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         for ( int j = i + 1; j < (int) m_SurfVec.size(); j++ )
@@ -776,6 +786,10 @@ void SurfaceIntersectionSingleton::Intersect()
         }
     }
 
+    //==== Keep Only Surface Pairs Seen This Run ====//
+    m_ISegCache.swap( m_NewISegCache );
+    m_NewISegCache.clear();
+
     BuildChains();
 
     MergeFeaPartSSEdgeOverlap(); // Only applicable to FEA Mesh
@@ -794,6 +808,34 @@ void SurfaceIntersectionSingleton::Intersect()
     BuildCurves();
 }
 
+void SurfaceIntersectionSingleton::IntersectSurfPatches( Surf* surfA, Surf* surfB )
+{
+    pair< size_t, size_t > key( surfA->GetGeomHash(), surfB->GetGeomHash() );
+
+    //==== Surface Pair Unchanged Since Last Run - Replay Its Segments ====//
+    map< pair< size_t, size_t >, ISegCacheEntry >::iterator it = m_ISegCache.find( key );
+    if ( it != m_ISegCache.end() && it->second.m_KeyA == surfA->GetGeomKey() && it->second.m_KeyB == surfB->GetGeomKey() )
+    {
+        vector< ISegRecord > & rec_vec = it->second.m_RecVec;
+        for ( int i = 0 ; i < ( int )rec_vec.size() ; i++ )
+        {
+            LoadIntersectionSeg( surfA, surfB, rec_vec[i] );
+        }
+        m_NewISegCache[key] = it->second;
+        return;
+    }
+
+    ISegCacheEntry & entry = m_NewISegCache[key];
+    entry.m_KeyA = surfA->GetGeomKey();
+    entry.m_KeyB = surfB->GetGeomKey();
+    m_ISegRecordVec = &entry.m_RecVec;
+    m_ISegRecordVec->clear();
+
+    surfA->IntersectPatches( surfB, this );
+
+    m_ISegRecordVec = NULL;
+}
+
 void SurfaceIntersectionSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 )
 {
     double d = dist_squared( ip0, ip1 );
@@ -861,20 +903,41 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch&
         }
     }
 
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+    ISegRecord rec;
+    rec.m_UWA[0] = proj_uwA0;
+    rec.m_UWA[1] = proj_uwA1;
+    rec.m_UWB[0] = proj_uwB0;
+    rec.m_UWB[1] = proj_uwB1;
+    rec.m_Pnt[0] = ip0;
+    rec.m_Pnt[1] = ip1;
+
+    if ( m_ISegRecordVec )
+    {
+        m_ISegRecordVec->push_back( rec );
+    }
+
+    LoadIntersectionSeg( pA.get_surf_ptr(), pB.get_surf_ptr(), rec );
+}
+
+void SurfaceIntersectionSingleton::LoadIntersectionSeg( Surf* surfA, Surf* surfB, const ISegRecord & rec )
+{
+    vec3d ip0 = rec.m_Pnt[0];
+    vec3d ip1 = rec.m_Pnt[1];
+
+    Puw* puwA0 = new Puw( surfA, rec.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( surfB, rec.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
     ipnt0->m_Pnt = ip0;
     m_DelIPntVec.push_back( ipnt0 );
 
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( surfA, rec.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( surfB, rec.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
@@ -914,7 +977,7 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch&
 
     if ( !match )
     {
-        new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+        new ISeg( surfA, surfB, ipnt0, ipnt1 );
 
         m_BinMap[id0].m_ID = id0;
         m_BinMap[id0].m_IPnts.push_back( ipnt0 );
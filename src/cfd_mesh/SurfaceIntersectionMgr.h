@@ -83,6 +83,22 @@
 using namespace std;
 
 
+//==== Projected Intersection Segment, Kept So Unchanged Surface Pairs Can Skip Patch Intersection ====//
+struct ISegRecord
+{
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+    vec3d m_Pnt[2];
+};
+
+//==== Recorded Segments Of One Surface Pair And The Full Geometry Keys They Came From ====//
+struct ISegCacheEntry
+{
+    vector< double > m_KeyA;
+    vector< double > m_KeyB;
+    vector< ISegRecord > m_RecVec;
+};
+
 class SurfaceIntersectionSingleton : public ParmContainer
 {
 protected:
@@ -139,7 +155,9 @@ public:
     virtual void Intersect();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
+    virtual void IntersectSurfPatches( Surf* surfA, Surf* surfB );
     virtual void AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 );
+    virtual void LoadIntersectionSeg( Surf* surfA, Surf* surfB, const ISegRecord & rec );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -248,6 +266,11 @@ protected:
 
     SimpleIntersectSettings m_IntersectSettings;
 
+    //==== Patch Intersection Segments From The Last Run Keyed By Surface Geometry Hash Pair ====//
+    map< pair< size_t, size_t >, ISegCacheEntry > m_ISegCache;
+    map< pair< size_t, size_t >, ISegCacheEntry > m_NewISegCache;
+    vector< ISegRecord >* m_ISegRecordVec;
+
     //==== Vector of Surfs that may have a border that lies on Surf A ====//
     map< Surf*, vector< Surf* > > m_PossCoPlanarSurfMap;
 
@@ -7,7 +7,15 @@
 
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
+#include "AdvLinkMgr.h"
+#include "LinkMgr.h"
+#include "SnapTo.h"
+#include "ParmMgr.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
 #include <float.h>
+#include <time.h>
+#include <algorithm>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -661,4 +669,905 @@ void APITestSuite::TestFEAMesh()
     printf( "\n" );
 
     printf( "COMPLETE\n" );
-}
\ No newline at end of file
+}
+
+//==== Adv Link Bodies - Plain Arithmetic The Compiler Takes, Then Bodies It Must Leave To The Script ====//
+static const char* s_AdvLinkCompiledCode[] =
+{
+    "y = x1 + x2;",
+    "y = 2.5 * x1 - x2 / 3.0;",
+    "y = sin( x1 ) * cos( x2 );",
+    "y = sqrt( x1 * x1 + x2 * x2 );",
+    "double t = x1 * 0.5;\ny = t + pow( x2, 2 );",
+    "y = Max( x1, x2 ) - Min( x1, x2 ) * 0.1;",
+    "y = Rad2Deg( atan2( x1, x2 ) );",
+    "y = -x1 * ( x2 + 1 ) / 7 + 1.0 / 3;",
+    "y = 0;\ny += x1;\ny *= x2;\ny -= 1e-3;",
+    "y = x1 % 0.75 + abs( x2 ) + floor( x2 * 10 ) % 3;",
+};
+
+static const char* s_AdvLinkScriptCode[] =
+{
+    "if ( x1 > x2 ) { y = x1; } else { y = x2; }",
+    "y = 0; for ( int i = 0 ; i < 3 ; i++ ) { y += x1 * i; }",
+    "y = x1 + 7 / 2;",
+};
+
+//==== Adv Link From User Parms x1 And x2 To y ====//
+static AdvLink* AddTestAdvLink( const string & code, const string & x1_id, const string & x2_id, const string & y_id, bool compile_flag )
+{
+    AdvLink* link = AdvLinkMgr.AddLink( "TestLink" );
+    AdvLinkMgr.AddInput( x1_id, "x1" );
+    AdvLinkMgr.AddInput( x2_id, "x2" );
+    AdvLinkMgr.AddOutput( y_id, "y" );
+    link->SetCompileFlag( compile_flag );
+    link->SetScriptCode( code );
+    link->BuildScript();
+    return link;
+}
+
+//==== Compiled Adv Links Must Match The Script Engine Exactly ====//
+void APITestSuite::TestAdvLinkCompile()
+{
+    printf( "APITestSuite::TestAdvLinkCompile()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string x1_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x1", "AdvLinkTest" );
+    string x2_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x2", "AdvLinkTest" );
+
+    int num_compiled = sizeof( s_AdvLinkCompiledCode ) / sizeof( s_AdvLinkCompiledCode[0] );
+    int num_script = sizeof( s_AdvLinkScriptCode ) / sizeof( s_AdvLinkScriptCode[0] );
+
+    vector< string > code_vec( s_AdvLinkCompiledCode, s_AdvLinkCompiledCode + num_compiled );
+    code_vec.insert( code_vec.end(), s_AdvLinkScriptCode, s_AdvLinkScriptCode + num_script );
+
+    vector< AdvLink* > compiled_vec;
+    vector< AdvLink* > script_vec;
+    vector< string > yc_vec;
+    vector< string > ys_vec;
+    for ( int i = 0 ; i < ( int )code_vec.size() ; i++ )
+    {
+        char name[64];
+        sprintf( name, "yc_%d", i );
+        yc_vec.push_back( LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, name, "AdvLinkTest" ) );
+        sprintf( name, "ys_%d", i );
+        ys_vec.push_back( LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, name, "AdvLinkTest" ) );
+
+        compiled_vec.push_back( AddTestAdvLink( code_vec[i], x1_id, x2_id, yc_vec[i], true ) );
+        script_vec.push_back( AddTestAdvLink( code_vec[i], x1_id, x2_id, ys_vec[i], false ) );
+
+        TEST_ASSERT( compiled_vec[i]->ValidScript() );
+        TEST_ASSERT( script_vec[i]->ValidScript() );
+        TEST_ASSERT( !script_vec[i]->CompiledScript() );
+
+        //==== Unsupported Bodies Fall Back To The Script ====//
+        TEST_ASSERT( compiled_vec[i]->CompiledScript() == ( i < num_compiled ) );
+    }
+
+    double x_val[][2] = { { 0.3, 1.7 }, { -2.25, 0.6 }, { 10.0, -3.5 }, { 1.0e-3, 4.0 }, { 7.125, 7.125 } };
+    int num_x = sizeof( x_val ) / sizeof( x_val[0] );
+
+    for ( int j = 0 ; j < num_x ; j++ )
+    {
+        vsp::SetParmVal( x1_id, x_val[j][0] );
+        vsp::SetParmVal( x2_id, x_val[j][1] );
+
+        for ( int i = 0 ; i < ( int )code_vec.size() ; i++ )
+        {
+            double yc = vsp::GetParmVal( yc_vec[i] );
+            double ys = vsp::GetParmVal( ys_vec[i] );
+            if ( yc != ys )
+            {
+                printf( "\tMismatch x1 = %g x2 = %g: %s -> compiled %.17g script %.17g\n",
+                        x_val[j][0], x_val[j][1], code_vec[i].c_str(), yc, ys );
+            }
+            TEST_ASSERT( yc == ys );
+        }
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Time 2000 Adv Links Compiled And Through The Script Engine ====//
+void APITestSuite::TestAdvLinkBenchmark()
+{
+    printf( "APITestSuite::TestAdvLinkBenchmark()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    int num_links = 2000;
+    int num_reps = 5;
+    int num_code = sizeof( s_AdvLinkCompiledCode ) / sizeof( s_AdvLinkCompiledCode[0] );
+
+    string x1_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x1", "AdvLinkBench" );
+    string x2_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x2", "AdvLinkBench" );
+    vsp::SetParmVal( x1_id, 0.4 );
+    vsp::SetParmVal( x2_id, 2.2 );
+
+    vector< AdvLink* > compiled_vec;
+    vector< AdvLink* > script_vec;
+    vector< string > yc_vec;
+    vector< string > ys_vec;
+    for ( int i = 0 ; i < num_links ; i++ )
+    {
+        char name[64];
+        sprintf( name, "yc_%d", i );
+        yc_vec.push_back( LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, name, "AdvLinkBench" ) );
+        sprintf( name, "ys_%d", i );
+        ys_vec.push_back( LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, name, "AdvLinkBench" ) );
+
+        compiled_vec.push_back( AddTestAdvLink( s_AdvLinkCompiledCode[ i % num_code ], x1_id, x2_id, yc_vec[i], true ) );
+        script_vec.push_back( AddTestAdvLink( s_AdvLinkCompiledCode[ i % num_code ], x1_id, x2_id, ys_vec[i], false ) );
+    }
+
+    clock_t start = clock();
+    for ( int r = 0 ; r < num_reps ; r++ )
+    {
+        for ( int i = 0 ; i < num_links ; i++ )
+        {
+            compiled_vec[i]->ForceUpdate();
+        }
+    }
+    double compiled_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for ( int r = 0 ; r < num_reps ; r++ )
+    {
+        for ( int i = 0 ; i < num_links ; i++ )
+        {
+            script_vec[i]->ForceUpdate();
+        }
+    }
+    double script_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    int num_evals = num_links * num_reps;
+    printf( "\t%d Links x %d: Compiled %.3f s ( %.0f Evals/s ), Script %.3f s ( %.0f Evals/s )\n", num_links, num_reps,
+            compiled_sec, num_evals / std::max( compiled_sec, 1.0e-9 ), script_sec, num_evals / std::max( script_sec, 1.0e-9 ) );
+
+    for ( int i = 0 ; i < num_links ; i++ )
+    {
+        TEST_ASSERT( compiled_vec[i]->CompiledScript() );
+        TEST_ASSERT( vsp::GetParmVal( yc_vec[i] ) == vsp::GetParmVal( ys_vec[i] ) );
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Pod Surface Length Along X ====//
+static double PodSurfLength( const string & pod_id )
+{
+    return std::abs( vsp::CompPnt01( pod_id, 0, 1.0, 0.0 ).x() - vsp::CompPnt01( pod_id, 0, 0.0, 0.0 ).x() );
+}
+
+//==== Geoms Dirtied By Outputs Of A Later Geom Must Still Be Rebuilt ====//
+void APITestSuite::TestUpdateDirtySet()
+{
+    printf( "APITestSuite::TestUpdateDirtySet()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Pod Is Updated Before The Wing That Drives It ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::Update();
+
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+    string tspan_id = vsp::GetParm( wing_id, "TotalSpan", "WingGeom" );
+    TEST_ASSERT( LinkMgr.AddLink( tspan_id, len_id ) );
+    double offset = vsp::GetParmVal( len_id ) - vsp::GetParmVal( tspan_id );
+
+    //==== Only The Wing Input Changes - TotalSpan Is Written During Its Update ====//
+    vsp::SetParmVal( wing_id, "Span", "XSec_1", 13.5 );
+    vsp::Update();
+
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_id ), vsp::GetParmVal( tspan_id ) + offset, 1.0e-9 );
+    TEST_ASSERT_DELTA( PodSurfLength( pod_id ), vsp::GetParmVal( len_id ), 1.0e-6 );
+
+    //==== Nothing Left Dirty - Another Update Changes Nothing ====//
+    double len = vsp::GetParmVal( len_id );
+    vsp::Update();
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_id ), len, TEST_TOL );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== A Link Crossing Two Concurrently Updated Subtrees Must Drive The Target Build ====//
+void APITestSuite::TestUpdateSubtreeLinks()
+{
+    printf( "APITestSuite::TestUpdateSubtreeLinks()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string wing_id = vsp::AddGeom( "WING" );
+    string other_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+    string tspan_id = vsp::GetParm( wing_id, "TotalSpan", "WingGeom" );
+    TEST_ASSERT( LinkMgr.AddLink( tspan_id, len_id ) );
+    double offset = vsp::GetParmVal( len_id ) - vsp::GetParmVal( tspan_id );
+
+    for ( int i = 0 ; i < 5 ; i++ )
+    {
+        //==== Every Subtree Changes, So All Are Candidates For The Parallel Pass ====//
+        vsp::SetParmVal( pod_id, "FineRatio", "Design", 10.0 + i );
+        vsp::SetParmVal( other_id, "Length", "Design", 4.0 + i );
+        vsp::SetParmVal( wing_id, "Span", "XSec_1", 8.0 + 2.5 * i );
+        vsp::Update();
+
+        TEST_ASSERT_DELTA( vsp::GetParmVal( len_id ), vsp::GetParmVal( tspan_id ) + offset, 1.0e-9 );
+        TEST_ASSERT_DELTA( PodSurfLength( pod_id ), vsp::GetParmVal( len_id ), 1.0e-6 );
+        TEST_ASSERT_DELTA( PodSurfLength( other_id ), 4.0 + i, 1.0e-6 );
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Draw Objects Are Rebuilt Only When Stale And Building Them Sets No Parms ====//
+void APITestSuite::TestLazyDrawObjs()
+{
+    printf( "APITestSuite::TestLazyDrawObjs()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string other_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+
+    Geom* pod = veh->FindGeom( pod_id );
+    Geom* other = veh->FindGeom( other_id );
+    TEST_ASSERT( pod && other );
+
+    vector< Geom* > geom_vec;
+    geom_vec.push_back( pod );
+    geom_vec.push_back( other );
+
+    //==== Full Update Leaves Draw Objects Stale Until Something Draws ====//
+    TEST_ASSERT( !pod->GetDrawObjValid() );
+    veh->UpdateStaleDrawObjs( geom_vec );
+    TEST_ASSERT( pod->GetDrawObjValid() && other->GetDrawObjValid() );
+
+    //==== Only The Changed Geom Goes Stale ====//
+    vsp::SetParmVal( pod_id, "Length", "Design", 9.0 );
+    vsp::Update();
+    TEST_ASSERT( !pod->GetDrawObjValid() );
+    TEST_ASSERT( other->GetDrawObjValid() );
+    veh->UpdateStaleDrawObjs( geom_vec );
+
+    //==== GuiDraw Settings Read By UpdateDrawObj Invalidate Without A Parm Change ====//
+    pod->m_GuiDraw.SetDispFeatureFlag( !pod->m_GuiDraw.GetDispFeatureFlag() );
+    pod->InvalidateDrawObj();
+    vsp::Update();
+    TEST_ASSERT( !pod->GetDrawObjValid() );
+    veh->UpdateStaleDrawObjs( geom_vec );
+    TEST_ASSERT( pod->GetDrawObjValid() );
+
+    //==== Mesh Draw Type Follows The Subsurface Flag Without Setting A Parm ====//
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    Geom* mesh = veh->FindGeom( mesh_id );
+    TEST_ASSERT( mesh );
+    if ( mesh )
+    {
+        geom_vec.push_back( mesh );
+        mesh->m_GuiDraw.SetDispSubSurfFlag( !mesh->m_GuiDraw.GetDispSubSurfFlag() );
+        mesh->InvalidateDrawObj();
+
+        int cnt = ParmMgr.GetLatestChangeCnt();
+        veh->UpdateStaleDrawObjs( geom_vec );
+        TEST_ASSERT( mesh->GetDrawObjValid() );
+        TEST_ASSERT( ParmMgr.GetLatestChangeCnt() == cnt );
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Slider Gestures Are Undone In One Step And The Journal Stays Under Its Cap ====//
+void APITestSuite::TestUndoGroups()
+{
+    printf( "APITestSuite::TestUndoGroups()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    size_t old_limit = ParmMgr.GetUndoMemLimit();
+    ParmMgr.SetUndoMemLimit( 1 << 20 );
+
+    string pod_id = vsp::AddGeom( "POD" );
+    Parm* p = ParmMgr.FindParm( vsp::GetParm( pod_id, "Length", "Design" ) );
+    TEST_ASSERT( p );
+    if ( !p )
+    {
+        return;
+    }
+    p->Set( 5.0 );
+
+    //==== Push Off The Knob Then Drag - One Entry ====//
+    p->SetFromDevice( 6.0, false );
+    p->SetFromDevice( 6.5, true );
+    p->SetFromDevice( 7.0, true );
+
+    //==== Grab The Knob Without Moving It Then Drag - A New Entry ====//
+    p->SetFromDevice( 7.0, false );
+    p->SetFromDevice( 7.5, true );
+    p->SetFromDevice( 8.0, true );
+
+    //==== Typed Value, Then A Drag Of The Same Parm - Separate Entries ====//
+    p->SetFromDevice( 9.0, false );
+    p->SetFromDevice( 9.0, false );
+    p->SetFromDevice( 9.5, true );
+
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( p->Get(), 9.0, TEST_TOL );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( p->Get(), 8.0, TEST_TOL );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( p->Get(), 7.0, TEST_TOL );
+    ParmMgr.UnDo();
+    TEST_ASSERT_DELTA( p->Get(), 5.0, TEST_TOL );
+
+    //==== Oldest Groups Are Dropped Past The Cap ====//
+    size_t limit = 10 * sizeof( ParmUndo );
+    ParmMgr.SetUndoMemLimit( limit );
+    for ( int i = 0 ; i < 50 ; i++ )
+    {
+        p->SetFromDevice( 10.0 + i, false );
+        TEST_ASSERT( ParmMgr.GetUndoMemUse() <= limit );
+    }
+    for ( int i = 0 ; i < 50 ; i++ )
+    {
+        ParmMgr.UnDo();
+    }
+    TEST_ASSERT_DELTA( p->Get(), 10.0 + 50 - 1 - limit / sizeof( ParmUndo ), TEST_TOL );
+    TEST_ASSERT( ParmMgr.GetUndoMemUse() == 0 );
+
+    ParmMgr.SetUndoMemLimit( old_limit );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Stale Handles Never Resolve, Even After Their Slot Is Reused Many Times ====//
+void APITestSuite::TestParmHandleReuse()
+{
+    printf( "APITestSuite::TestParmHandleReuse()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Removed Slots Are Reused Last In First Out - Well Past The Generation Range ====//
+    int num_reuse = 4 * ( ParmMgr.HANDLE_GEN_MASK + 1 );
+    vector< int > handle_vec;
+    for ( int i = 0 ; i < num_reuse ; i++ )
+    {
+        Parm* p = new Parm();
+        p->Init( "Reuse", "HandleTest", NULL, 1.0, 0.0, 10.0 );
+        handle_vec.push_back( p->GetHandle() );
+        TEST_ASSERT( ParmMgr.FindParm( p->GetHandle() ) == p );
+        delete p;
+    }
+
+    Parm* live = new Parm();
+    live->Init( "Live", "HandleTest", NULL, 1.0, 0.0, 10.0 );
+
+    for ( int i = 0 ; i < ( int )handle_vec.size() ; i++ )
+    {
+        TEST_ASSERT( ParmMgr.FindParm( handle_vec[i] ) == NULL );
+        TEST_ASSERT( ParmMgr.GetHandleID( handle_vec[i] ).empty() );
+    }
+    TEST_ASSERT( ParmMgr.FindParm( live->GetHandle() ) == live );
+
+    delete live;
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Lookup Through Interned Handles Versus String IDs ====//
+void APITestSuite::TestParmHandleBenchmark()
+{
+    printf( "APITestSuite::TestParmHandleBenchmark()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    int num_geom = 50;
+    int num_reps = 200;
+
+    vector< string > id_vec;
+    for ( int i = 0 ; i < num_geom ; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vector< string > parm_vec = vsp::FindContainerParmIDs( pod_id );
+        id_vec.insert( id_vec.end(), parm_vec.begin(), parm_vec.end() );
+    }
+
+    vector< int > handle_vec( id_vec.size() );
+    for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+    {
+        handle_vec[i] = ParmMgr.FindHandle( id_vec[i] );
+    }
+
+    double id_sum = 0.0;
+    clock_t start = clock();
+    for ( int r = 0 ; r < num_reps ; r++ )
+    {
+        for ( int i = 0 ; i < ( int )id_vec.size() ; i++ )
+        {
+            id_sum += ParmMgr.FindParm( id_vec[i] )->Get();
+        }
+    }
+    double id_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    double handle_sum = 0.0;
+    start = clock();
+    for ( int r = 0 ; r < num_reps ; r++ )
+    {
+        for ( int i = 0 ; i < ( int )handle_vec.size() ; i++ )
+        {
+            handle_sum += ParmMgr.FindParm( handle_vec[i] )->Get();
+        }
+    }
+    double handle_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    int num_finds = ( int )id_vec.size() * num_reps;
+    printf( "\t%d Parms x %d: String ID %.3f s ( %.0f Finds/s ), Handle %.3f s ( %.0f Finds/s )\n", ( int )id_vec.size(), num_reps,
+            id_sec, num_finds / std::max( id_sec, 1.0e-9 ), handle_sec, num_finds / std::max( handle_sec, 1.0e-9 ) );
+
+    TEST_ASSERT( id_sum == handle_sum );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Nested Transactions Propagate Links In One Pass On The Outer Commit ====//
+void APITestSuite::TestParmTransactions()
+{
+    printf( "APITestSuite::TestParmTransactions()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string x1_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x1", "TransactionTest" );
+    string x2_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "x2", "TransactionTest" );
+    string y_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "y", "TransactionTest" );
+    string z_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "z", "TransactionTest" );
+
+    AddTestAdvLink( "y = x1 + x2;", x1_id, x2_id, y_id, true );
+    TEST_ASSERT( LinkMgr.AddLink( x1_id, z_id ) );
+    double offset = vsp::GetParmVal( z_id ) - vsp::GetParmVal( x1_id );
+
+    int pass_cnt = AdvLinkMgr.GetUpdatePassCnt();
+    int run_cnt = AdvLinkMgr.GetLinkRunCnt();
+
+    vsp::BeginParmTransaction();
+    vsp::SetParmVal( x1_id, 1.5 );
+    vsp::BeginParmTransaction();
+    vsp::SetParmVal( x2_id, 2.25 );
+    vsp::SetParmVal( x1_id, 3.0 );
+    vsp::CommitParmTransaction();
+
+    //==== Inner Commit Propagates Nothing ====//
+    TEST_ASSERT( AdvLinkMgr.GetUpdatePassCnt() == pass_cnt );
+    TEST_ASSERT( AdvLinkMgr.GetLinkRunCnt() == run_cnt );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( z_id ), offset, TEST_TOL );
+
+    vsp::CommitParmTransaction();
+
+    //==== Outer Commit Runs One Pass And The Adv Link Once ====//
+    TEST_ASSERT( AdvLinkMgr.GetUpdatePassCnt() == pass_cnt + 1 );
+    TEST_ASSERT( AdvLinkMgr.GetLinkRunCnt() == run_cnt + 1 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( y_id ), 5.25, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( z_id ), 3.0 + offset, TEST_TOL );
+
+    //==== End Closes Open Levels And Keeps Their Values - It Is Not A Rollback ====//
+    pass_cnt = AdvLinkMgr.GetUpdatePassCnt();
+    vsp::BeginParmTransaction();
+    vsp::BeginParmTransaction();
+    vsp::SetParmVal( x2_id, 4.0 );
+    vsp::EndParmTransaction();
+
+    TEST_ASSERT( !ParmMgr.InTransaction() );
+    TEST_ASSERT( AdvLinkMgr.GetUpdatePassCnt() == pass_cnt + 1 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( y_id ), 7.0, TEST_TOL );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Adv Links Added Out Of Dependency Order Still Run Once Each, Inputs First ====//
+void APITestSuite::TestAdvLinkRankOrder()
+{
+    printf( "APITestSuite::TestAdvLinkRankOrder()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    string a_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "a", "RankTest" );
+    string b_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "b", "RankTest" );
+    string c_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "c", "RankTest" );
+    string d_id = LinkMgr.AddUserParm( PARM_DOUBLE_TYPE, "d", "RankTest" );
+
+    //==== Diamond a -> b -> c, ( b, c ) -> d - Downstream Links Added First ====//
+    AddTestAdvLink( "y = x1 + x2;", b_id, c_id, d_id, true );
+    AddTestAdvLink( "y = x1 + 1.0 + 0.0 * x2;", b_id, b_id, c_id, true );
+    AddTestAdvLink( "y = 2.0 * x1 + 0.0 * x2;", a_id, a_id, b_id, true );
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        double a = 1.25 + i;
+        int run_cnt = AdvLinkMgr.GetLinkRunCnt();
+
+        vsp::SetParmVal( a_id, a );
+
+        TEST_ASSERT_DELTA( vsp::GetParmVal( b_id ), 2.0 * a, TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( c_id ), 2.0 * a + 1.0, TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( d_id ), 4.0 * a + 1.0, TEST_TOL );
+        TEST_ASSERT( AdvLinkMgr.GetLinkRunCnt() == run_cnt + 3 );
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Clearance From A SnapTo Without Cached Meshes ====//
+static double FreshClearance()
+{
+    SnapTo fresh;
+    fresh.CheckClearance();
+    return fresh.m_CollisionMinDist;
+}
+
+//==== Cached Collision Meshes Follow Moves, Reshapes And Replaced Geoms ====//
+void APITestSuite::TestSnapToCache()
+{
+    printf( "APITestSuite::TestSnapToCache()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    SnapTo* snap = veh->GetSnapToPtr();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string other_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( other_id, "Y_Rel_Location", "XForm", 3.0 );
+    vsp::Update();
+    veh->SetActiveGeom( pod_id );
+
+    snap->CheckClearance();
+    double dist = snap->m_CollisionMinDist;
+    TEST_ASSERT( dist > 0.0 );
+    TEST_ASSERT_DELTA( dist, FreshClearance(), 1.0e-9 );
+
+    //==== Transform Only - Cached Mesh Is Refit ====//
+    vsp::SetParmVal( other_id, "Y_Rel_Location", "XForm", 4.0 );
+    vsp::Update();
+    snap->CheckClearance();
+    TEST_ASSERT( snap->m_CollisionMinDist > dist );
+    TEST_ASSERT_DELTA( snap->m_CollisionMinDist, FreshClearance(), 1.0e-9 );
+
+    //==== Shape Change Of The Active Geom ====//
+    vsp::SetParmVal( pod_id, "FineRatio", "Design", 3.0 );
+    vsp::Update();
+    snap->CheckClearance();
+    TEST_ASSERT_DELTA( snap->m_CollisionMinDist, FreshClearance(), 1.0e-9 );
+
+    //==== Tessellation Change - Tri Counts Differ So The Mesh Is Rebuilt ====//
+    vsp::SetParmVal( other_id, "Tess_U", "Shape", 21 );
+    vsp::Update();
+    snap->CheckClearance();
+    TEST_ASSERT_DELTA( snap->m_CollisionMinDist, FreshClearance(), 1.0e-9 );
+
+    //==== Deleted Geom Is Purged, Its Replacement Is Meshed ====//
+    vsp::DeleteGeom( other_id );
+    string new_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( new_id, "Z_Rel_Location", "XForm", -2.5 );
+    vsp::Update();
+    veh->SetActiveGeom( pod_id );
+    snap->CheckClearance();
+    TEST_ASSERT_DELTA( snap->m_CollisionMinDist, FreshClearance(), 1.0e-9 );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Clearance While Dragging One Geom Among Many - Cached Versus Rebuilt Meshes ====//
+void APITestSuite::TestSnapToBenchmark()
+{
+    printf( "APITestSuite::TestSnapToBenchmark()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    int num_geom = 100;
+    int num_steps = 20;
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    SnapTo* snap = veh->GetSnapToPtr();
+
+    vector< string > id_vec;
+    for ( int i = 0 ; i < num_geom ; i++ )
+    {
+        id_vec.push_back( vsp::AddGeom( "POD" ) );
+        vsp::SetParmVal( id_vec[i], "X_Rel_Location", "XForm", 6.0 * ( i % 10 ) );
+        vsp::SetParmVal( id_vec[i], "Y_Rel_Location", "XForm", 3.0 * ( i / 10 ) );
+    }
+    vsp::Update();
+    veh->SetActiveGeom( id_vec[0] );
+
+    double cached_sum = 0.0;
+    clock_t start = clock();
+    for ( int s = 0 ; s < num_steps ; s++ )
+    {
+        vsp::SetParmVal( id_vec[0], "Z_Rel_Location", "XForm", 0.05 * s );
+        vsp::Update();
+        snap->CheckClearance();
+        cached_sum += snap->m_CollisionMinDist;
+    }
+    double cached_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    double fresh_sum = 0.0;
+    start = clock();
+    for ( int s = 0 ; s < num_steps ; s++ )
+    {
+        vsp::SetParmVal( id_vec[0], "Z_Rel_Location", "XForm", 0.05 * s );
+        vsp::Update();
+        fresh_sum += FreshClearance();
+    }
+    double fresh_sec = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    printf( "\t%d Geoms x %d Steps: Cached %.3f s ( %.1f Steps/s ), Rebuilt %.3f s ( %.1f Steps/s )\n", num_geom, num_steps,
+            cached_sec, num_steps / std::max( cached_sec, 1.0e-9 ), fresh_sec, num_steps / std::max( fresh_sec, 1.0e-9 ) );
+
+    TEST_ASSERT_DELTA( cached_sum, fresh_sum, 1.0e-9 );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Single Leaf Over Every Tri - Same Primitive Tests As The BVH Without The Hierarchy ====//
+static void FlattenTBndBox( TBndBox & box )
+{
+    if ( box.m_NodeVec.empty() )
+    {
+        return;
+    }
+    box.m_NodeVec.resize( 1 );
+    box.m_NodeVec[0].m_Start = 0;
+    box.m_NodeVec[0].m_Count = ( int )box.m_TriVec.size();
+}
+
+//==== Meshes Of One Geom With Loaded BVHs - Caller Deletes ====//
+static vector< TMesh* > CreateBvhTMeshVec( const string & geom_id, double & build_sec )
+{
+    vector< TMesh* > tmesh_vec = VehicleMgr.GetVehicle()->FindGeom( geom_id )->CreateTMeshVec();
+
+    clock_t start = clock();
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->LoadBndBox();
+    }
+    build_sec += ( double )( clock() - start ) / CLOCKS_PER_SEC;
+
+    return tmesh_vec;
+}
+
+//==== BVH Queries Versus A Brute Force Scan Of The Same Meshes ====//
+void APITestSuite::TestTMeshBvhBenchmark()
+{
+    printf( "APITestSuite::TestTMeshBvhBenchmark()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    int num_rays = 500;
+    int num_reps = 20;
+
+    //==== Two Stretched Intersecting Ellipsoids And A Coarse Separate One ====//
+    string e1_id = vsp::AddGeom( "ELLIPSOID" );
+    vsp::SetParmVal( e1_id, "A_Radius", "Design", 4.0 );
+    vsp::SetParmVal( e1_id, "Tess_U", "Shape", 41 );
+    vsp::SetParmVal( e1_id, "Tess_W", "Shape", 41 );
+
+    string e2_id = vsp::AddGeom( "ELLIPSOID" );
+    vsp::SetParmVal( e2_id, "B_Radius", "Design", 3.0 );
+    vsp::SetParmVal( e2_id, "X_Rel_Location", "XForm", 1.5 );
+    vsp::SetParmVal( e2_id, "Z_Rel_Rotation", "XForm", 30.0 );
+    vsp::SetParmVal( e2_id, "Tess_U", "Shape", 41 );
+    vsp::SetParmVal( e2_id, "Tess_W", "Shape", 41 );
+
+    string e3_id = vsp::AddGeom( "ELLIPSOID" );
+    vsp::SetParmVal( e3_id, "Z_Rel_Location", "XForm", 3.5 );
+    vsp::SetParmVal( e3_id, "Tess_U", "Shape", 17 );
+    vsp::SetParmVal( e3_id, "Tess_W", "Shape", 17 );
+    vsp::Update();
+
+    double build_sec = 0.0;
+    vector< TMesh* > bvh1_vec = CreateBvhTMeshVec( e1_id, build_sec );
+    vector< TMesh* > bvh2_vec = CreateBvhTMeshVec( e2_id, build_sec );
+    vector< TMesh* > bvh3_vec = CreateBvhTMeshVec( e3_id, build_sec );
+
+    double dummy_sec = 0.0;
+    vector< TMesh* > flat1_vec = CreateBvhTMeshVec( e1_id, dummy_sec );
+    vector< TMesh* > flat2_vec = CreateBvhTMeshVec( e2_id, dummy_sec );
+    vector< TMesh* > flat3_vec = CreateBvhTMeshVec( e3_id, dummy_sec );
+
+    TEST_ASSERT( !bvh1_vec.empty() && !bvh2_vec.empty() && !bvh3_vec.empty() );
+    if ( bvh1_vec.empty() || bvh2_vec.empty() || bvh3_vec.empty() )
+    {
+        return;
+    }
+
+    TMesh* bvh[] = { bvh1_vec[0], bvh2_vec[0], bvh3_vec[0] };
+    TMesh* flat[] = { flat1_vec[0], flat2_vec[0], flat3_vec[0] };
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        FlattenTBndBox( flat[i]->m_TBox );
+    }
+
+    //==== Rays From Outside Through The Pair ====//
+    vector< vec3d > orig_vec( num_rays );
+    vector< vec3d > dir_vec( num_rays );
+    for ( int i = 0 ; i < num_rays ; i++ )
+    {
+        double a = 2.0 * PI * i / num_rays;
+        orig_vec[i] = vec3d( 10.0 * cos( a ), 10.0 * sin( a ), 3.0 * sin( 7.0 * a ) );
+        dir_vec[i] = vec3d( 0.5 * sin( 3.0 * a ), 0.5 * cos( 5.0 * a ), 0.0 ) - orig_vec[i];
+    }
+
+    TMesh* ray_mesh[] = { bvh[0], bvh[1], flat[0], flat[1] };
+    vector< int > num_hit[2];
+    double ray_sec[2];
+    for ( int k = 0 ; k < 2 ; k++ )
+    {
+        clock_t start = clock();
+        for ( int i = 0 ; i < num_rays ; i++ )
+        {
+            int n = 0;
+            for ( int m = 0 ; m < 2 ; m++ )
+            {
+                vector< double > t_vec;
+                ray_mesh[ 2 * k + m ]->m_TBox.RayCast( orig_vec[i], dir_vec[i], t_vec );
+                n += ( int )t_vec.size();
+            }
+            num_hit[k].push_back( n );
+        }
+        ray_sec[k] = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+    }
+    TEST_ASSERT( num_hit[0] == num_hit[1] );
+
+    //==== Mesh Vs Mesh Intersect Check ====//
+    double isect_sec[2];
+    bool isect_flag[2];
+    for ( int k = 0 ; k < 2 ; k++ )
+    {
+        TMesh** tm = ( k == 0 ) ? bvh : flat;
+        clock_t start = clock();
+        for ( int r = 0 ; r < num_reps ; r++ )
+        {
+            isect_flag[k] = tm[0]->CheckIntersect( tm[1] );
+        }
+        isect_sec[k] = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+    }
+    TEST_ASSERT( isect_flag[0] && isect_flag[1] );
+
+    //==== Min Distance To The Separate Mesh ====//
+    double dist_sec[2];
+    double dist[2];
+    for ( int k = 0 ; k < 2 ; k++ )
+    {
+        TMesh** tm = ( k == 0 ) ? bvh : flat;
+        clock_t start = clock();
+        dist[k] = tm[0]->MinDistance( tm[2], 1.0e12 );
+        dist_sec[k] = ( double )( clock() - start ) / CLOCKS_PER_SEC;
+    }
+    TEST_ASSERT( dist[0] > 0.0 );
+    TEST_ASSERT_DELTA( dist[0], dist[1], 1.0e-12 );
+
+    printf( "\tBVH Build: %d + %d + %d Tris %.3f s\n", ( int )bvh[0]->m_TVec.size(), ( int )bvh[1]->m_TVec.size(),
+            ( int )bvh[2]->m_TVec.size(), build_sec );
+    printf( "\t%d Rays: BVH %.3f s, Brute Force %.3f s\n", num_rays, ray_sec[0], ray_sec[1] );
+    printf( "\tIntersect Check x %d: BVH %.3f s, Brute Force %.3f s\n", num_reps, isect_sec[0], isect_sec[1] );
+    printf( "\tMin Distance: BVH %.3f s, Brute Force %.3f s\n", dist_sec[0], dist_sec[1] );
+
+    vector< TMesh* > del_vec[] = { bvh1_vec, bvh2_vec, bvh3_vec, flat1_vec, flat2_vec, flat3_vec };
+    for ( int i = 0 ; i < 6 ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )del_vec[i].size() ; j++ )
+        {
+            delete del_vec[i][j];
+        }
+    }
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
+
+//==== Tessellated Ellipsoid Volume Is Linear In Each Radius, So dV/dA = V/A Exactly ====//
+void APITestSuite::TestDesignVarGradient()
+{
+    printf( "APITestSuite::TestDesignVarGradient()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( veh->GetVSPScriptCmd().empty() )
+    {
+        printf( "\tvspscript not found in %s, skipping\n", veh->GetExePath().c_str() );
+        printf( "COMPLETE\n" );
+        return;
+    }
+
+    double a = 3.0;
+    double b = 2.0;
+    double c = 1.5;
+
+    string ell_id = vsp::AddGeom( "ELLIPSOID" );
+    TEST_ASSERT( ell_id.size() > 0 );
+    vsp::SetParmVal( ell_id, "A_Radius", "Design", a );
+    vsp::SetParmVal( ell_id, "B_Radius", "Design", b );
+    vsp::SetParmVal( ell_id, "C_Radius", "Design", c );
+    vsp::Update();
+
+    vsp::AddDesignVar( vsp::GetParm( ell_id, "A_Radius", "Design" ), vsp::XDDM_VAR );
+    vsp::AddDesignVar( vsp::GetParm( ell_id, "B_Radius", "Design" ), vsp::XDDM_VAR );
+
+    vsp::SetAnalysisInputDefaults( "DesignVarGradient" );
+    vsp::SetStringAnalysisInput( "DesignVarGradient", "Analysis", vector< string >( 1, "CompGeom" ) );
+    vsp::SetStringAnalysisInput( "DesignVarGradient", "Outputs", vector< string >( 1, "Total_Theo_Vol" ) );
+
+    int ngeom = ( int )veh->GetGeomVec( false ).size();
+
+    string res_id = vsp::ExecAnalysis( "DesignVarGradient" );
+    TEST_ASSERT( res_id.size() > 0 );
+
+    const vector< int > & valid_vec = vsp::GetIntResults( res_id, "Var_Valid" );
+    TEST_ASSERT( valid_vec.size() == 2 );
+    TEST_ASSERT( valid_vec[0] == 1 && valid_vec[1] == 1 );
+
+    double vol = vsp::GetDoubleResults( res_id, "Output_Val" )[0];
+    const vector< double > & jac = vsp::GetDoubleResults( res_id, "Jacobian", 0 );
+    TEST_ASSERT( jac.size() == 2 );
+
+    //==== Exact For The Tessellation, And Close To The Smooth 4/3 Pi B C ====//
+    TEST_ASSERT_DELTA( jac[0], vol / a, 1.0e-6 * vol );
+    TEST_ASSERT_DELTA( jac[1], vol / b, 1.0e-6 * vol );
+    TEST_ASSERT_DELTA( jac[0], 4.0 / 3.0 * PI * b * c, 0.02 * 4.0 / 3.0 * PI * b * c );
+
+    //==== Parms Restored And No Mesh Geoms Left Behind ====//
+    TEST_ASSERT_DELTA( vsp::GetParmVal( ell_id, "A_Radius", "Design" ), a, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( ell_id, "B_Radius", "Design" ), b, TEST_TOL );
+    TEST_ASSERT( ( int )veh->GetGeomVec( false ).size() == ngeom );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::VSPRenew();
+    printf( "COMPLETE\n" );
+}
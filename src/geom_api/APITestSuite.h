@@ -37,6 +37,27 @@ public:
         TEST_ADD( APITestSuite::TestSaveLoad )
         // FEA Mesh
         TEST_ADD( APITestSuite::TestFEAMesh )
+        // Advanced Links
+        TEST_ADD( APITestSuite::TestAdvLinkCompile )
+        TEST_ADD( APITestSuite::TestAdvLinkBenchmark )
+        TEST_ADD( APITestSuite::TestParmTransactions )
+        TEST_ADD( APITestSuite::TestAdvLinkRankOrder )
+        // Vehicle Update
+        TEST_ADD( APITestSuite::TestUpdateDirtySet )
+        TEST_ADD( APITestSuite::TestUpdateSubtreeLinks )
+        TEST_ADD( APITestSuite::TestLazyDrawObjs )
+        // Mesh BVH
+        TEST_ADD( APITestSuite::TestTMeshBvhBenchmark )
+        // SnapTo
+        TEST_ADD( APITestSuite::TestSnapToCache )
+        TEST_ADD( APITestSuite::TestSnapToBenchmark )
+        // Undo
+        TEST_ADD( APITestSuite::TestUndoGroups )
+        // Parm Handles
+        TEST_ADD( APITestSuite::TestParmHandleReuse )
+        TEST_ADD( APITestSuite::TestParmHandleBenchmark )
+        // Design Var Gradient
+        TEST_ADD( APITestSuite::TestDesignVarGradient )
     }
 
 private:
@@ -57,6 +78,27 @@ private:
     void TestSaveLoad();
     // FEA Mesh
     void TestFEAMesh();
+    // Advanced Links
+    void TestAdvLinkCompile();
+    void TestAdvLinkBenchmark();
+    void TestParmTransactions();
+    void TestAdvLinkRankOrder();
+    // Vehicle Update
+    void TestUpdateDirtySet();
+    void TestUpdateSubtreeLinks();
+    void TestLazyDrawObjs();
+    // Mesh BVH
+    void TestTMeshBvhBenchmark();
+    // SnapTo
+    void TestSnapToCache();
+    void TestSnapToBenchmark();
+    // Undo
+    void TestUndoGroups();
+    // Parm Handles
+    void TestParmHandleReuse();
+    void TestParmHandleBenchmark();
+    // Design Var Gradient
+    void TestDesignVarGradient();
 };
 
 #endif // !defined(VSPAPITESTSUITE__INCLUDED_)
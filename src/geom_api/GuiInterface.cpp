@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "GuiInterface.h"
+#include "ParmMgr.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -15,9 +16,11 @@
 
 #ifdef VSP_USE_FLTK
 #include "ScreenMgr.h"
+#include <FL/Fl_Preferences.H>
 #endif
 
 #include <stddef.h>
+#include <algorithm>
 
 //==== Constructor ====//
 GuiInterface::GuiInterface()
@@ -40,6 +43,15 @@ void GuiInterface::InitGui( Vehicle* vPtr )
     {
         m_ScreenMgr = new ScreenMgr( vPtr );
     }
+
+    //==== Headless Runs Never Undo, So Only Journal Once There Is A Gui ====//
+    if ( ParmMgr.GetUndoMemLimit() == 0 )
+    {
+        Fl_Preferences prefs( Fl_Preferences::USER, "openvsp.org", "VSP" );
+        int limit;
+        prefs.get( "UndoMemLimit", limit, ParmMgrSingleton::UNDO_DEFAULT_MEM_LIMIT );
+        ParmMgr.SetUndoMemLimit( ( size_t )std::max( limit, 0 ) );
+    }
 #endif
 
 }
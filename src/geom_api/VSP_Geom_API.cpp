@@ -2579,6 +2579,7 @@ vector<vec3d> ReadFileXSec( const string& xsec_id, const string& file_name )
         assert( file_xs );
         if ( file_xs->ReadXsecFile( file_name ) )
         {
+            xs->ParmChanged( NULL, Parm::SET ); // Flag Geom For Update
             ErrorMgr.NoError();
             return file_xs->GetUnityFilePnts();
         }
@@ -2611,6 +2612,7 @@ void SetXSecPnts( const string& xsec_id, vector< vec3d > & pnt_vec )
     FileXSec* file_xs = dynamic_cast<FileXSec*>( xs->GetXSecCurve() );
     assert( file_xs );
     file_xs->SetPnts( pnt_vec );
+    xs->ParmChanged( NULL, Parm::SET ); // Flag Geom For Update
     ErrorMgr.NoError();
 }
 
@@ -2782,6 +2784,7 @@ void ReadFileAirfoil( const string& xsec_id, const string& file_name )
         assert( file_xs );
         if( file_xs->ReadFile( file_name ) )
         {
+            xs->ParmChanged( NULL, Parm::SET ); // Flag Geom For Update
             ErrorMgr.NoError();
             return;
         }
@@ -2814,6 +2817,7 @@ void SetAirfoilPnts( const string& xsec_id, std::vector< vec3d > & up_pnt_vec, s
     FileAirfoil* file_xs = dynamic_cast<FileAirfoil*>( xs->GetXSecCurve() );
     assert( file_xs );
     file_xs->SetAirfoilPnts( up_pnt_vec, low_pnt_vec );
+    xs->ParmChanged( NULL, Parm::SET ); // Flag Geom For Update
     ErrorMgr.NoError();
 }
 
@@ -3753,6 +3757,50 @@ double SetParmValUpdate( const string & geom_id, const string & parm_name, const
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Open a parm set transaction.  Parms set before the matching commit only record
+/// their values; link propagation and the vehicle update run once on commit.
+void BeginParmTransaction()
+{
+    ParmMgr.BeginTransaction();
+    ErrorMgr.NoError();
+}
+
+/// Close a parm set transaction, propagate links and update the vehicle once.
+void CommitParmTransaction()
+{
+    ParmMgr.CommitTransaction();
+    ErrorMgr.NoError();
+}
+
+/// Close every open parm set transaction level, e.g. after an error skipped a commit.
+/// This is not a rollback: values already set are kept, and links and the vehicle
+/// update run once as on commit.
+void EndParmTransaction()
+{
+    ParmMgr.EndTransaction();
+    ErrorMgr.NoError();
+}
+
+/// Set the memory cap of the parm undo journal in bytes.  The oldest undo steps
+/// are dropped to stay under it; zero turns undo off and clears the journal.
+void SetUndoMemLimit( int limit_bytes )
+{
+    if ( limit_bytes < 0 )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "SetUndoMemLimit::Limit Must Not Be Negative" );
+        return;
+    }
+    ParmMgr.SetUndoMemLimit( ( size_t )limit_bytes );
+    ErrorMgr.NoError();
+}
+
+/// Get the memory cap of the parm undo journal in bytes.
+int GetUndoMemLimit()
+{
+    ErrorMgr.NoError();
+    return ( int )ParmMgr.GetUndoMemLimit();
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
@@ -245,6 +245,11 @@ extern double SetParmVal( const std::string & geom_id, const std::string & name,
 extern double SetParmValLimits( const std::string & parm_id, double val, double lower_limit, double upper_limit );
 extern double SetParmValUpdate( const std::string & parm_id, double val );
 extern double SetParmValUpdate( const std::string & geom_id, const std::string & parm_name, const std::string & parm_group_name, double val );
+extern void BeginParmTransaction();
+extern void CommitParmTransaction();
+extern void EndParmTransaction();
+extern void SetUndoMemLimit( int limit_bytes );
+extern int GetUndoMemLimit();
 extern double GetParmVal( const std::string & parm_id );
 extern double GetParmVal( const std::string & geom_id, const std::string & name, const std::string & group );
 extern int GetIntParmVal( const std::string & parm_id );
@@ -45,6 +45,8 @@ xmlNodePtr VarDef::DecodeXml( xmlNodePtr & var_node )
 AdvLink::AdvLink()
 {
     m_ValidScript = false;
+    m_CompileFlag = true;
+    m_HandleFreeCnt = 0;
 }
 
 //==== Destructor ====//
@@ -90,6 +92,8 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
     else
         m_OutputVars.push_back( pd );
 
+    m_Expr.Clear();
+    AdvLinkMgr.InvalidateIndex();
 }
 
 void AdvLink::DeleteVar( int index, bool input_flag )
@@ -102,6 +106,9 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     {
         m_OutputVars.erase( m_OutputVars.begin() + index );
     }
+
+    m_Expr.Clear();
+    AdvLinkMgr.InvalidateIndex();
 }
 
 void AdvLink::DeleteAllVars( bool input_flag )
@@ -114,6 +121,9 @@ void AdvLink::DeleteAllVars( bool input_flag )
     {
         m_OutputVars.clear();
     }
+
+    m_Expr.Clear();
+    AdvLinkMgr.InvalidateIndex();
 }
 
 void AdvLink::SetVar( const string & var_name, double val )
@@ -155,6 +165,7 @@ bool AdvLink::BuildScript()
     string script;
 
     m_ValidScript = false;
+    m_Expr.Clear();
 
     //==== Find All Var Names ====//
     vector< string > var_vec;
@@ -224,9 +235,37 @@ bool AdvLink::BuildScript()
     }
 
     m_ValidScript = true;
+
+    //==== Plain Arithmetic Also Compiles To Stack Code - Outputs Start Unset Like The Script Globals ====//
+    if ( m_CompileFlag && m_Expr.Compile( m_ScriptCode, var_vec ) )
+    {
+        InternVarHandles();
+        for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
+        {
+            m_Expr.SetSlot( (int)m_InputVars.size() + i, -1.0e15 );
+        }
+    }
+
     return true;
 }
 
+//==== Intern Var Parm IDs - Again Whenever A Removed Parm May Have Made Them Stale ====//
+void AdvLink::InternVarHandles()
+{
+    m_HandleFreeCnt = ParmMgr.GetHandleFreeCnt();
+
+    m_InputHandleVec.resize( m_InputVars.size() );
+    for ( int i = 0 ; i < (int)m_InputVars.size() ; i++ )
+    {
+        m_InputHandleVec[i] = ParmMgr.InternID( m_InputVars[i].m_ParmID );
+    }
+    m_OutputHandleVec.resize( m_OutputVars.size() );
+    for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
+    {
+        m_OutputHandleVec[i] = ParmMgr.InternID( m_OutputVars[i].m_ParmID );
+    }
+}
+
 bool AdvLink::UpdateLink( const string & pid )
 {
     //==== Check Parm  ====//
@@ -245,10 +284,7 @@ bool AdvLink::UpdateLink( const string & pid )
     if ( !run_link )
         return false;
 
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    ForceUpdate();
 
     return true;
 }
@@ -257,6 +293,40 @@ void AdvLink::ForceUpdate()
 {
     AdvLinkMgr.SetActiveLink( this );
 
+    //==== Compiled Links Do What The Generated UpdateLink() Does Without The Script Engine ====//
+    if ( m_Expr.IsCompiled() )
+    {
+        if ( m_HandleFreeCnt != ParmMgr.GetHandleFreeCnt() )
+        {
+            InternVarHandles();
+        }
+
+        int num_in = (int)m_InputVars.size();
+        for ( int i = 0 ; i < num_in ; i++ )
+        {
+            Parm* parm_ptr = ParmMgr.FindParm( m_InputHandleVec[i] );
+            m_Expr.SetSlot( i, parm_ptr ? parm_ptr->Get() : 0.0 );
+        }
+
+        if ( !m_Expr.Eval() )
+        {
+            return;
+        }
+
+        for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
+        {
+            double val = m_Expr.GetSlot( num_in + i );
+            Parm* parm_ptr = ParmMgr.FindParm( m_OutputHandleVec[i] );
+            if ( parm_ptr && val > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
+            {
+                parm_ptr->SetFromLink( val );
+            }
+        }
+
+        vsp::Update();
+        return;
+    }
+
     //==== Call Script ====//
     ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
 }
@@ -311,6 +381,9 @@ xmlNodePtr AdvLink::DecodeXml( xmlNodePtr & adv_link_node )
             xmlNodePtr var_def_node = XmlUtil::GetNode( output_node, "VarDef", i );
             m_OutputVars[i].DecodeXml( var_def_node );
         }
+
+        m_Expr.Clear();
+        AdvLinkMgr.InvalidateIndex();
     }
 
     return adv_link_node;
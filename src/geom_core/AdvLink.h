@@ -16,6 +16,7 @@
 
 #include "Parm.h"
 #include "ParmContainer.h"
+#include "AdvLinkExpr.h"
 
 using std::string;
 
@@ -53,6 +54,8 @@ public:
     bool BuildScript();
     void SetValidScriptFlag( bool flag )                            { m_ValidScript = flag; }
     bool ValidScript()                                              { return m_ValidScript; }
+    void SetCompileFlag( bool flag )                                { m_CompileFlag = flag; }
+    bool CompiledScript()                                           { return m_Expr.IsCompiled(); }
     string GetScriptErrors()                                        { return m_ScriptErrors; }
     bool ValidParms();
 
@@ -89,6 +92,14 @@ protected:
 
     bool m_ValidScript;
     string m_ScriptErrors;
+
+    bool m_CompileFlag;                 // False Always Runs The Script, E.g. To Check The Compiled Path
+    AdvLinkExpr m_Expr;                 // Compiled Script When It Is Plain Arithmetic
+    vector< int > m_InputHandleVec;     // Interned Var Parm IDs Used By m_Expr
+    vector< int > m_OutputHandleVec;
+    int m_HandleFreeCnt;                // ParmMgr Free Count When Handles Were Interned
+
+    void InternVarHandles();
      
 private:
 
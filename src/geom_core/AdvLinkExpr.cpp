@@ -0,0 +1,688 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// AdvLinkExpr.cpp: Compiled form of adv link scripts that are plain arithmetic
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "AdvLinkExpr.h"
+#include "Defines.h"
+
+#include <cmath>
+#include <cctype>
+#include <climits>
+
+enum { TOK_END, TOK_NUM, TOK_INT, TOK_IDENT, TOK_OP, TOK_BAD };
+
+//==== Same Definitions As The Functions Registered With The Script Engine ====//
+// scriptmath registers the float versions, so arguments and results round through float.
+static double ExprCos( double x )                   { return cosf( ( float )x ); }
+static double ExprSin( double x )                   { return sinf( ( float )x ); }
+static double ExprTan( double x )                   { return tanf( ( float )x ); }
+static double ExprAcos( double x )                  { return acosf( ( float )x ); }
+static double ExprAsin( double x )                  { return asinf( ( float )x ); }
+static double ExprAtan( double x )                  { return atanf( ( float )x ); }
+static double ExprCosh( double x )                  { return coshf( ( float )x ); }
+static double ExprSinh( double x )                  { return sinhf( ( float )x ); }
+static double ExprTanh( double x )                  { return tanhf( ( float )x ); }
+static double ExprLog( double x )                   { return logf( ( float )x ); }
+static double ExprLog10( double x )                 { return log10f( ( float )x ); }
+static double ExprSqrt( double x )                  { return sqrtf( ( float )x ); }
+static double ExprCeil( double x )                  { return ceilf( ( float )x ); }
+static double ExprAbs( double x )                   { return fabsf( ( float )x ); }
+static double ExprFloor( double x )                 { return floorf( ( float )x ); }
+static double ExprFraction( double x )              { float ipart; return modff( ( float )x, &ipart ); }
+static double ExprRad2Deg( double r )               { return r * RAD_2_DEG; }
+static double ExprDeg2Rad( double d )               { return d * DEG_2_RAD; }
+static double ExprAtan2( double y, double x )       { return atan2f( ( float )y, ( float )x ); }
+static double ExprPow( double x, double y )         { return powf( ( float )x, ( float )y ); }
+static double ExprMin( double x, double y )         { return ( x < y ) ? x : y; }
+static double ExprMax( double x, double y )         { return ( x > y ) ? x : y; }
+
+//==== Parse Double Literal The Way The Script Engine Does ====//
+// Its scanner accumulates digits in double rather than rounding correctly like atof,
+// so literals such as 0.7 can land one ulp away from the atof value.
+static double ScriptScanDouble( const string & str )
+{
+    double value = 0;
+    double fraction = 0.1;
+    int exponent = 0;
+    bool neg_exp_flag = false;
+    size_t c = 0;
+
+    while ( c < str.size() && isdigit( ( unsigned char )str[c] ) )
+    {
+        value = value * 10 + double( str[c] - '0' );
+        c++;
+    }
+
+    if ( c < str.size() && str[c] == '.' )
+    {
+        c++;
+        while ( c < str.size() && isdigit( ( unsigned char )str[c] ) )
+        {
+            value += fraction * double( str[c] - '0' );
+            fraction *= 0.1;
+            c++;
+        }
+    }
+
+    if ( c < str.size() && ( str[c] == 'e' || str[c] == 'E' ) )
+    {
+        c++;
+        if ( c < str.size() && str[c] == '-' )
+        {
+            neg_exp_flag = true;
+            c++;
+        }
+        else if ( c < str.size() && str[c] == '+' )
+        {
+            c++;
+        }
+        while ( c < str.size() && isdigit( ( unsigned char )str[c] ) )
+        {
+            exponent = exponent * 10 + int( str[c] - '0' );
+            c++;
+        }
+    }
+
+    if ( exponent )
+    {
+        if ( neg_exp_flag )
+        {
+            exponent = -exponent;
+        }
+        value *= pow( 10.0, exponent );
+    }
+
+    return value;
+}
+
+struct ExprFuncDef
+{
+    const char* m_Name;
+    double ( *m_Func1 )( double );
+    double ( *m_Func2 )( double, double );
+    bool m_FloatFlag;
+};
+
+static const ExprFuncDef expr_func_defs[] =
+{
+    { "cos", ExprCos, NULL, true }, { "sin", ExprSin, NULL, true }, { "tan", ExprTan, NULL, true },
+    { "acos", ExprAcos, NULL, true }, { "asin", ExprAsin, NULL, true }, { "atan", ExprAtan, NULL, true },
+    { "cosh", ExprCosh, NULL, true }, { "sinh", ExprSinh, NULL, true }, { "tanh", ExprTanh, NULL, true },
+    { "log", ExprLog, NULL, true }, { "log10", ExprLog10, NULL, true }, { "sqrt", ExprSqrt, NULL, true },
+    { "ceil", ExprCeil, NULL, true }, { "abs", ExprAbs, NULL, true }, { "floor", ExprFloor, NULL, true },
+    { "fraction", ExprFraction, NULL, true }, { "Rad2Deg", ExprRad2Deg, NULL, false }, { "Deg2Rad", ExprDeg2Rad, NULL, false },
+    { "atan2", NULL, ExprAtan2, true }, { "pow", NULL, ExprPow, true }, { "Min", NULL, ExprMin, false }, { "Max", NULL, ExprMax, false },
+};
+
+//==== Constructor ====//
+AdvLinkExpr::AdvLinkExpr()
+{
+    m_Pos = 0;
+    m_TokType = TOK_END;
+    m_Depth = 0;
+    m_CompiledFlag = false;
+}
+
+void AdvLinkExpr::Clear()
+{
+    m_CompiledFlag = false;
+    m_OpVec.clear();
+    m_SlotVec.clear();
+    m_Stack.clear();
+    m_SlotMap.clear();
+    m_Code.clear();
+}
+
+//==== Compile Script Body - Returns False If Anything But Arithmetic Assignments Appear ====//
+bool AdvLinkExpr::Compile( const string & code, const vector< string > & var_names )
+{
+    Clear();
+
+    m_SlotVec.assign( var_names.size(), 0.0 );
+    for ( int i = 0 ; i < ( int )var_names.size() ; i++ )
+    {
+        m_SlotMap[ var_names[i] ] = i;
+    }
+
+    m_Code = code;
+    m_Pos = 0;
+    m_Depth = 0;
+
+    NextToken();
+    while ( m_TokType != TOK_END )
+    {
+        if ( !ParseStatement() )
+        {
+            Clear();
+            return false;
+        }
+    }
+
+    m_Code.clear();
+    m_SlotMap.clear();
+    m_CompiledFlag = true;
+    return true;
+}
+
+//==== Run Compiled Code Against The Slots - False Where The Script Would Raise Divide By Zero ====//
+bool AdvLinkExpr::Eval()
+{
+    if ( m_OpVec.empty() )
+    {
+        return true;
+    }
+
+    double* stack = &m_Stack[0];
+    double* slot = &m_SlotVec[0];
+    int top = -1;
+
+    for ( int i = 0 ; i < ( int )m_OpVec.size() ; i++ )
+    {
+        const ExprOp & op = m_OpVec[i];
+        switch ( op.m_Code )
+        {
+        case EXPR_CONST:
+            stack[++top] = op.m_Val;
+            break;
+        case EXPR_LOAD:
+            stack[++top] = slot[op.m_Ind];
+            break;
+        case EXPR_STORE:
+            slot[op.m_Ind] = stack[top--];
+            break;
+        case EXPR_NEG:
+            stack[top] = -stack[top];
+            break;
+        case EXPR_ADD:
+            stack[top - 1] += stack[top];
+            top--;
+            break;
+        case EXPR_SUB:
+            stack[top - 1] -= stack[top];
+            top--;
+            break;
+        case EXPR_MUL:
+            stack[top - 1] *= stack[top];
+            top--;
+            break;
+        case EXPR_DIV:
+            if ( stack[top] == 0 )
+            {
+                return false;
+            }
+            stack[top - 1] /= stack[top];
+            top--;
+            break;
+        case EXPR_MOD:
+            if ( stack[top] == 0 )
+            {
+                return false;
+            }
+            stack[top - 1] = fmod( stack[top - 1], stack[top] );
+            top--;
+            break;
+        case EXPR_FUNC1:
+            stack[top] = op.m_Func1( stack[top] );
+            break;
+        case EXPR_FUNC2:
+            stack[top - 1] = op.m_Func2( stack[top - 1], stack[top] );
+            top--;
+            break;
+        case EXPR_ROUND_FLOAT:
+            stack[top - op.m_Ind] = ( float )stack[top - op.m_Ind];
+            break;
+        }
+    }
+    return true;
+}
+
+//==== Append Op And Track Stack Depth ====//
+void AdvLinkExpr::AddOp( int code, int ind, double val )
+{
+    ExprOp op;
+    op.m_Code = code;
+    op.m_Ind = ind;
+    op.m_Val = val;
+    op.m_Func1 = NULL;
+    op.m_Func2 = NULL;
+    m_OpVec.push_back( op );
+
+    if ( code == EXPR_CONST || code == EXPR_LOAD )
+    {
+        m_Depth++;
+        if ( m_Depth > ( int )m_Stack.size() )
+        {
+            m_Stack.resize( m_Depth );
+        }
+    }
+    else if ( code != EXPR_NEG && code != EXPR_FUNC1 && code != EXPR_ROUND_FLOAT )
+    {
+        m_Depth--;
+    }
+}
+
+//==== Scan Next Token, Skipping White Space And Comments ====//
+bool AdvLinkExpr::NextToken()
+{
+    m_Tok.clear();
+
+    while ( m_Pos < m_Code.size() )
+    {
+        if ( isspace( ( unsigned char )m_Code[m_Pos] ) )
+        {
+            m_Pos++;
+        }
+        else if ( m_Code.compare( m_Pos, 2, "//" ) == 0 )
+        {
+            m_Pos = m_Code.find( '\n', m_Pos );
+            if ( m_Pos == string::npos )
+            {
+                m_Pos = m_Code.size();
+            }
+        }
+        else if ( m_Code.compare( m_Pos, 2, "/*" ) == 0 )
+        {
+            size_t end = m_Code.find( "*/", m_Pos + 2 );
+            if ( end == string::npos )
+            {
+                m_TokType = TOK_BAD;
+                return false;
+            }
+            m_Pos = end + 2;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if ( m_Pos >= m_Code.size() )
+    {
+        m_TokType = TOK_END;
+        return true;
+    }
+
+    size_t start = m_Pos;
+    char c = m_Code[m_Pos];
+
+    if ( isdigit( ( unsigned char )c ) || ( c == '.' && m_Pos + 1 < m_Code.size() && isdigit( ( unsigned char )m_Code[m_Pos + 1] ) ) )
+    {
+        m_TokType = TOK_INT;
+        while ( m_Pos < m_Code.size() && isdigit( ( unsigned char )m_Code[m_Pos] ) )
+        {
+            m_Pos++;
+        }
+        if ( m_Pos < m_Code.size() && m_Code[m_Pos] == '.' )
+        {
+            m_TokType = TOK_NUM;
+            m_Pos++;
+            while ( m_Pos < m_Code.size() && isdigit( ( unsigned char )m_Code[m_Pos] ) )
+            {
+                m_Pos++;
+            }
+        }
+        if ( m_Pos < m_Code.size() && ( m_Code[m_Pos] == 'e' || m_Code[m_Pos] == 'E' ) )
+        {
+            m_TokType = TOK_NUM;
+            m_Pos++;
+            if ( m_Pos < m_Code.size() && ( m_Code[m_Pos] == '+' || m_Code[m_Pos] == '-' ) )
+            {
+                m_Pos++;
+            }
+            if ( m_Pos >= m_Code.size() || !isdigit( ( unsigned char )m_Code[m_Pos] ) )
+            {
+                m_TokType = TOK_BAD;
+                return false;
+            }
+            while ( m_Pos < m_Code.size() && isdigit( ( unsigned char )m_Code[m_Pos] ) )
+            {
+                m_Pos++;
+            }
+        }
+
+        //==== Suffixes And Hex Literals Are Not Plain Doubles ====//
+        if ( m_Pos < m_Code.size() && ( isalnum( ( unsigned char )m_Code[m_Pos] ) || m_Code[m_Pos] == '_' || m_Code[m_Pos] == '.' ) )
+        {
+            m_TokType = TOK_BAD;
+            return false;
+        }
+    }
+    else if ( isalpha( ( unsigned char )c ) || c == '_' )
+    {
+        m_TokType = TOK_IDENT;
+        while ( m_Pos < m_Code.size() && ( isalnum( ( unsigned char )m_Code[m_Pos] ) || m_Code[m_Pos] == '_' ) )
+        {
+            m_Pos++;
+        }
+    }
+    else if ( string( "+-*/" ).find( c ) != string::npos && m_Pos + 1 < m_Code.size() && m_Code[m_Pos + 1] == '=' )
+    {
+        m_TokType = TOK_OP;
+        m_Pos += 2;
+    }
+    else if ( string( "+-*/%(),;=" ).find( c ) != string::npos )
+    {
+        m_TokType = TOK_OP;
+        m_Pos++;
+    }
+    else
+    {
+        m_TokType = TOK_BAD;
+        return false;
+    }
+
+    m_Tok = m_Code.substr( start, m_Pos - start );
+    return true;
+}
+
+//==== [double] var ( = | += | -= | *= | /= ) expr ; ====//
+bool AdvLinkExpr::ParseStatement()
+{
+    if ( m_TokType == TOK_OP && m_Tok == ";" )
+    {
+        return NextToken();
+    }
+
+    bool decl_flag = false;
+    if ( m_TokType == TOK_IDENT && m_Tok == "double" )
+    {
+        decl_flag = true;
+        NextToken();
+    }
+
+    if ( m_TokType != TOK_IDENT )
+    {
+        return false;
+    }
+    string name = m_Tok;
+
+    NextToken();
+    if ( m_TokType != TOK_OP )
+    {
+        return false;
+    }
+    string assign = m_Tok;
+    if ( assign != "=" && assign != "+=" && assign != "-=" && assign != "*=" && assign != "/=" )
+    {
+        return false;
+    }
+
+    //==== Locals May Not Shadow Or Read Themselves In Their Initializer ====//
+    map< string, int >::iterator it = m_SlotMap.find( name );
+    int slot;
+    if ( decl_flag )
+    {
+        if ( it != m_SlotMap.end() || assign != "=" )
+        {
+            return false;
+        }
+        slot = ( int )m_SlotVec.size();
+        m_SlotVec.push_back( 0.0 );
+    }
+    else
+    {
+        if ( it == m_SlotMap.end() )
+        {
+            return false;
+        }
+        slot = it->second;
+    }
+
+    NextToken();
+
+    if ( assign != "=" )
+    {
+        AddOp( EXPR_LOAD, slot );
+    }
+
+    int type;
+    if ( !ParseExpr( type ) )
+    {
+        return false;
+    }
+
+    if ( assign == "+=" )
+    {
+        AddOp( EXPR_ADD );
+    }
+    else if ( assign == "-=" )
+    {
+        AddOp( EXPR_SUB );
+    }
+    else if ( assign == "*=" )
+    {
+        AddOp( EXPR_MUL );
+    }
+    else if ( assign == "/=" )
+    {
+        AddOp( EXPR_DIV );
+    }
+    AddOp( EXPR_STORE, slot );
+
+    if ( decl_flag )
+    {
+        m_SlotMap[ name ] = slot;
+    }
+
+    if ( m_TokType != TOK_OP || m_Tok != ";" )
+    {
+        return false;
+    }
+    return NextToken();
+}
+
+//==== Emit Binary Op With The Script Engine's Type Promotion ====//
+// Float results are rounded back to float; +-*/ of floats done in double and rounded
+// give the same result as float arithmetic.
+bool AdvLinkExpr::AddBinaryOp( int code, int lhs_type, int rhs_type, int & type )
+{
+    if ( lhs_type == TYPE_INT && rhs_type == TYPE_INT )
+    {
+        //==== Integer Products Can Overflow And Integer Quotients Truncate ====//
+        if ( code != EXPR_ADD && code != EXPR_SUB )
+        {
+            return false;
+        }
+        AddOp( code );
+        type = TYPE_INT;
+        return true;
+    }
+
+    if ( lhs_type == TYPE_DOUBLE || rhs_type == TYPE_DOUBLE )
+    {
+        AddOp( code );
+        type = TYPE_DOUBLE;
+        return true;
+    }
+
+    if ( lhs_type == TYPE_INT )
+    {
+        AddOp( EXPR_ROUND_FLOAT, 1 );
+    }
+    if ( rhs_type == TYPE_INT )
+    {
+        AddOp( EXPR_ROUND_FLOAT, 0 );
+    }
+    AddOp( code );
+    AddOp( EXPR_ROUND_FLOAT, 0 );
+    type = TYPE_FLOAT;
+    return true;
+}
+
+//==== Sum Of Terms ====//
+bool AdvLinkExpr::ParseExpr( int & type )
+{
+    if ( !ParseTerm( type ) )
+    {
+        return false;
+    }
+
+    while ( m_TokType == TOK_OP && ( m_Tok == "+" || m_Tok == "-" ) )
+    {
+        int code = ( m_Tok == "+" ) ? EXPR_ADD : EXPR_SUB;
+        NextToken();
+
+        int rhs_type;
+        if ( !ParseTerm( rhs_type ) || !AddBinaryOp( code, type, rhs_type, type ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Product Of Unary Factors ====//
+bool AdvLinkExpr::ParseTerm( int & type )
+{
+    if ( !ParseUnary( type ) )
+    {
+        return false;
+    }
+
+    while ( m_TokType == TOK_OP && ( m_Tok == "*" || m_Tok == "/" || m_Tok == "%" ) )
+    {
+        int code = EXPR_MUL;
+        if ( m_Tok == "/" )
+        {
+            code = EXPR_DIV;
+        }
+        else if ( m_Tok == "%" )
+        {
+            code = EXPR_MOD;
+        }
+        NextToken();
+
+        int rhs_type;
+        if ( !ParseUnary( rhs_type ) || !AddBinaryOp( code, type, rhs_type, type ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Leading Sign ====//
+bool AdvLinkExpr::ParseUnary( int & type )
+{
+    if ( m_TokType == TOK_OP && ( m_Tok == "-" || m_Tok == "+" ) )
+    {
+        bool neg_flag = ( m_Tok == "-" );
+        NextToken();
+        if ( !ParseUnary( type ) )
+        {
+            return false;
+        }
+        if ( neg_flag )
+        {
+            AddOp( EXPR_NEG );
+        }
+        return true;
+    }
+    return ParsePrimary( type );
+}
+
+//==== Number, Var, Function Call Or Parenthesized Expression ====//
+bool AdvLinkExpr::ParsePrimary( int & type )
+{
+    type = TYPE_DOUBLE;
+
+    if ( m_TokType == TOK_NUM || m_TokType == TOK_INT )
+    {
+        double val = ScriptScanDouble( m_Tok );
+        if ( m_TokType == TOK_INT )
+        {
+            if ( val > INT_MAX )
+            {
+                return false;
+            }
+            type = TYPE_INT;
+        }
+        AddOp( EXPR_CONST, 0, val );
+        return NextToken();
+    }
+
+    if ( m_TokType == TOK_OP && m_Tok == "(" )
+    {
+        NextToken();
+        if ( !ParseExpr( type ) )
+        {
+            return false;
+        }
+        if ( m_TokType != TOK_OP || m_Tok != ")" )
+        {
+            return false;
+        }
+        return NextToken();
+    }
+
+    if ( m_TokType != TOK_IDENT )
+    {
+        return false;
+    }
+
+    string name = m_Tok;
+    NextToken();
+
+    //==== Var ====//
+    if ( m_TokType != TOK_OP || m_Tok != "(" )
+    {
+        map< string, int >::iterator it = m_SlotMap.find( name );
+        if ( it == m_SlotMap.end() )
+        {
+            return false;
+        }
+        AddOp( EXPR_LOAD, it->second );
+        return true;
+    }
+
+//==== Function Call ====//
+    const ExprFuncDef* def = NULL;
+    for ( int i = 0 ; i < ( int )( sizeof( expr_func_defs ) / sizeof( expr_func_defs[0] ) ) ; i++ )
+    {
+        if ( name == expr_func_defs[i].m_Name )
+        {
+            def = &expr_func_defs[i];
+            break;
+        }
+    }
+    if ( !def )
+    {
+        return false;
+    }
+
+    int nargs = def->m_Func1 ? 1 : 2;
+    NextToken();
+    for ( int i = 0 ; i < nargs ; i++ )
+    {
+        int arg_type;
+        if ( !ParseExpr( arg_type ) )
+        {
+            return false;
+        }
+
+        string sep = ( i == nargs - 1 ) ? ")" : ",";
+        if ( m_TokType != TOK_OP || m_Tok != sep )
+        {
+            return false;
+        }
+        NextToken();
+    }
+
+    if ( def->m_Func1 )
+    {
+        AddOp( EXPR_FUNC1 );
+        m_OpVec.back().m_Func1 = def->m_Func1;
+    }
+    else
+    {
+        AddOp( EXPR_FUNC2 );
+        m_OpVec.back().m_Func2 = def->m_Func2;
+    }
+    type = def->m_FloatFlag ? TYPE_FLOAT : TYPE_DOUBLE;
+    return m_TokType != TOK_BAD;
+}
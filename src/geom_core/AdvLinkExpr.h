@@ -0,0 +1,80 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// AdvLinkExpr.h: Compiled form of adv link scripts that are plain arithmetic
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_ADVLINKEXPR__INCLUDED_)
+#define VSP_ADVLINKEXPR__INCLUDED_
+
+#include <string>
+#include <vector>
+#include <map>
+
+using std::string;
+using std::vector;
+using std::map;
+
+//==== Stack Code For Adv Link Scripts Made Only Of Assignments Of Arithmetic Expressions ====//
+// Scripts using anything else (control flow, API calls, strings) are left to AngelScript.
+class AdvLinkExpr
+{
+public:
+    AdvLinkExpr();
+
+    void Clear();
+
+    //==== Compile Script Body - Vars Map To The First Slots In Order ====//
+    bool Compile( const string & code, const vector< string > & var_names );
+    bool IsCompiled() const                                 { return m_CompiledFlag; }
+
+    //==== Slots Persist Between Runs Like The Script Globals ====//
+    void SetSlot( int index, double val )                   { m_SlotVec[index] = val; }
+    double GetSlot( int index ) const                       { return m_SlotVec[index]; }
+
+    bool Eval();
+
+protected:
+
+    enum { EXPR_CONST, EXPR_LOAD, EXPR_STORE, EXPR_NEG, EXPR_ADD, EXPR_SUB,
+           EXPR_MUL, EXPR_DIV, EXPR_MOD, EXPR_FUNC1, EXPR_FUNC2, EXPR_ROUND_FLOAT };
+
+    //==== Script Types Of Sub Expressions ====//
+    enum { TYPE_INT, TYPE_FLOAT, TYPE_DOUBLE };
+
+    struct ExprOp
+    {
+        int m_Code;
+        int m_Ind;
+        double m_Val;
+        double ( *m_Func1 )( double );
+        double ( *m_Func2 )( double, double );
+    };
+
+    //==== Parser State ====//
+    bool NextToken();
+    bool ParseStatement();
+    bool ParseExpr( int & type );
+    bool ParseTerm( int & type );
+    bool ParseUnary( int & type );
+    bool ParsePrimary( int & type );
+    bool AddBinaryOp( int code, int lhs_type, int rhs_type, int & type );
+    void AddOp( int code, int ind = 0, double val = 0.0 );
+
+    string m_Code;
+    size_t m_Pos;
+    int m_TokType;
+    string m_Tok;
+    int m_Depth;
+    map< string, int > m_SlotMap;
+
+    bool m_CompiledFlag;
+    vector< ExprOp > m_OpVec;
+    vector< double > m_SlotVec;
+    vector< double > m_Stack;
+};
+
+#endif // !defined(VSP_ADVLINKEXPR__INCLUDED_)
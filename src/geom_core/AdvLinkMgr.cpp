@@ -22,6 +22,11 @@ AdvLinkMgrSingleton::AdvLinkMgrSingleton()
 {
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_IndexValid = false;
+    m_IndexFreeCnt = 0;
+    m_UpdatingFlag = false;
+    m_UpdatePassCnt = 0;
+    m_LinkRunCnt = 0;
 
 }
 
@@ -40,6 +45,7 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    m_IndexValid = false;
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -81,6 +87,7 @@ AdvLink* AdvLinkMgrSingleton::AddLink( const string & name )
     alink->SetName( link_name );
     m_LinkVec.push_back( alink );
     m_EditLinkIndex = (int)m_LinkVec.size() - 1;
+    m_IndexValid = false;
 
     return alink;
 }
@@ -95,6 +102,7 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
 
     vector_remove_val( m_LinkVec, link_ptr );
     delete link_ptr;
+    m_IndexValid = false;
 }
 
 void AdvLinkMgrSingleton::DelAllLinks( )
@@ -107,6 +115,7 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+    m_IndexValid = false;
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -202,57 +211,219 @@ double AdvLinkMgrSingleton::GetVar( const string & var_name )
 
 bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
 {
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    return IsInputParm( ParmMgr.FindHandle( pid ) );
+}
+
+bool AdvLinkMgrSingleton::IsInputParm( int handle )
+{
+    BuildIndex();
+
+    if ( m_InputLinkMap.find( handle ) != m_InputLinkMap.end() )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetInputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        if ( ParmMgr.FindParm( handle ) )
+        {
+            return true;
+        }
     }
     return false;
 }
 
 bool AdvLinkMgrSingleton::IsOutputParm( const string& pid )
 {
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    BuildIndex();
+
+    int handle = ParmMgr.FindHandle( pid );
+    if ( m_OutputLinkMap.find( handle ) != m_OutputLinkMap.end() )
     {
-         vector< VarDef > def_vec = m_LinkVec[i]->GetOutputVars();
-         for ( int j = 0 ; j < (int)def_vec.size() ; j++ )
-         {
-             if ( pid == def_vec[j].m_ParmID )
-             {
-                 if ( ParmMgr.FindParm( pid ) )
-                 {
-                     return true;
-                 }
-             }
-         }
+        if ( ParmMgr.FindParm( handle ) )
+        {
+            return true;
+        }
     }
     return false;
 }
 
+//==== Index Links By Input And Output Parm And Rank Them In Dependency Order ====//
+void AdvLinkMgrSingleton::BuildIndex()
+{
+    if ( m_IndexValid && m_IndexFreeCnt == ParmMgr.GetHandleFreeCnt() )
+    {
+        return;
+    }
+
+    m_InputLinkMap.clear();
+    m_OutputLinkMap.clear();
+    m_LinkOutputVec.assign( m_LinkVec.size(), vector< int >() );
+
+    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    {
+        vector< VarDef > in_vec = m_LinkVec[i]->GetInputVars();
+        for ( int j = 0 ; j < (int)in_vec.size() ; j++ )
+        {
+            vector< int > & ind_vec = m_InputLinkMap[ ParmMgr.InternID( in_vec[j].m_ParmID ) ];
+            if ( ind_vec.empty() || ind_vec.back() != i )
+            {
+                ind_vec.push_back( i );
+            }
+        }
+        vector< VarDef > out_vec = m_LinkVec[i]->GetOutputVars();
+        for ( int j = 0 ; j < (int)out_vec.size() ; j++ )
+        {
+            int out_handle = ParmMgr.InternID( out_vec[j].m_ParmID );
+            m_LinkOutputVec[i].push_back( out_handle );
+            vector< int > & ind_vec = m_OutputLinkMap[ out_handle ];
+            if ( ind_vec.empty() || ind_vec.back() != i )
+            {
+                ind_vec.push_back( i );
+            }
+        }
+    }
+
+    //==== Link -> Links Reading Its Outputs ====//
+    int nlink = (int)m_LinkVec.size();
+    vector< vector< int > > down_vec( nlink );
+    vector< int > num_up( nlink, 0 );
+    for ( int i = 0 ; i < nlink ; i++ )
+    {
+        std::set< int > down_set;
+        vector< VarDef > out_vec = m_LinkVec[i]->GetOutputVars();
+        for ( int j = 0 ; j < (int)out_vec.size() ; j++ )
+        {
+            unordered_map< int, vector< int > >::iterator it = m_InputLinkMap.find( ParmMgr.InternID( out_vec[j].m_ParmID ) );
+            if ( it != m_InputLinkMap.end() )
+            {
+                down_set.insert( it->second.begin(), it->second.end() );
+            }
+        }
+        down_vec[i].assign( down_set.begin(), down_set.end() );
+        for ( int j = 0 ; j < (int)down_vec[i].size() ; j++ )
+        {
+            num_up[ down_vec[i][j] ]++;
+        }
+    }
+
+    //==== Kahn Ordering - Links On Cycles Keep Their List Order After All Others ====//
+    m_LinkRank.assign( nlink, -1 );
+    deque< int > ready;
+    for ( int i = 0 ; i < nlink ; i++ )
+    {
+        if ( num_up[i] == 0 )
+        {
+            ready.push_back( i );
+        }
+    }
+
+    int rank = 0;
+    while ( !ready.empty() )
+    {
+        int i = ready.front();
+        ready.pop_front();
+        m_LinkRank[i] = rank++;
+        for ( int j = 0 ; j < (int)down_vec[i].size() ; j++ )
+        {
+            num_up[ down_vec[i][j] ]--;
+            if ( num_up[ down_vec[i][j] ] == 0 )
+            {
+                ready.push_back( down_vec[i][j] );
+            }
+        }
+    }
+    for ( int i = 0 ; i < nlink ; i++ )
+    {
+        if ( m_LinkRank[i] < 0 )
+        {
+            m_LinkRank[i] = rank++;
+        }
+    }
+
+    m_IndexValid = true;
+    m_IndexFreeCnt = ParmMgr.GetHandleFreeCnt();
+}
+
 //==== Parm Changed ====//
 void AdvLinkMgrSingleton::UpdateLinks( const string& pid  )
+{
+    UpdateLinks( ParmMgr.FindHandle( pid ) );
+}
+
+void AdvLinkMgrSingleton::UpdateLinks( int handle )
 {
     //==== Find Parm Ptr ===//
-    Parm* parm_ptr = ParmMgr.FindParm( pid );
+    Parm* parm_ptr = ParmMgr.FindParm( handle );
     if ( !parm_ptr )
     {
         return;
     }
 
-    //==== Check All Links And Update If Needed ====//
-    for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
+    BuildIndex();
+
+    //==== Queue Only The Links Reading This Parm ====//
+    unordered_map< int, vector< int > >::iterator it = m_InputLinkMap.find( handle );
+    if ( it != m_InputLinkMap.end() )
+    {
+        for ( int i = 0 ; i < (int)it->second.size() ; i++ )
+        {
+            int ind = it->second[i];
+            if ( m_RunLinkSet.find( ind ) == m_RunLinkSet.end() )
+            {
+                m_PendingLinkSet.insert( std::make_pair( m_LinkRank[ind], ind ) );
+            }
+        }
+    }
+
+    //==== Outputs Set By A Running Link Land Here - The Outer Pass Runs Them ====//
+    if ( BeginUpdatePass() )
+    {
+        EndUpdatePass();
+    }
+}
+
+//==== Parms Written By Links Reading This Parm ====//
+void AdvLinkMgrSingleton::GetDrivenParms( int handle, vector< int > & driven_vec )
+{
+    BuildIndex();
+
+    unordered_map< int, vector< int > >::iterator it = m_InputLinkMap.find( handle );
+    if ( it != m_InputLinkMap.end() )
     {
-        m_LinkVec[i]->UpdateLink( pid );
+        for ( int i = 0 ; i < (int)it->second.size() ; i++ )
+        {
+            const vector< int > & out_vec = m_LinkOutputVec[ it->second[i] ];
+            driven_vec.insert( driven_vec.end(), out_vec.begin(), out_vec.end() );
+        }
+    }
+}
+
+//==== Open Pass - False If One Is Already Running ====//
+bool AdvLinkMgrSingleton::BeginUpdatePass()
+{
+    if ( m_UpdatingFlag )
+    {
+        return false;
+    }
+
+    m_UpdatingFlag = true;
+    m_UpdatePassCnt++;
+    return true;
+}
+
+//==== Run In Rank Order So Each Link Sees Final Inputs And Runs Once ====//
+void AdvLinkMgrSingleton::EndUpdatePass()
+{
+    while ( !m_PendingLinkSet.empty() )
+    {
+        int ind = m_PendingLinkSet.begin()->second;
+        m_PendingLinkSet.erase( m_PendingLinkSet.begin() );
+        m_RunLinkSet.insert( ind );
+
+        if ( ind < (int)m_LinkVec.size() )
+        {
+            m_LinkRunCnt++;
+            m_LinkVec[ind]->ForceUpdate();
+        }
     }
+    m_RunLinkSet.clear();
+    m_UpdatingFlag = false;
 }
 
 //==== Force Update of All Links ====//
@@ -13,9 +13,12 @@
 
 #include "AdvLink.h"
 #include <deque>
+#include <set>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Adv Link Manager ====//
@@ -46,9 +49,19 @@ public:
     double GetVar( const string & var_name );
 
     bool IsInputParm( const string& pid );
+    bool IsInputParm( int handle );
     bool IsOutputParm( const string& pid );
     void UpdateLinks( const string& pid );
+    void UpdateLinks( int handle );
+    void GetDrivenParms( int handle, vector< int > & driven_vec );
+
+    //==== Links Queued Between Begin And End Of A Pass Run Once, In Rank Order ====//
+    bool BeginUpdatePass();
+    void EndUpdatePass();
+    int GetUpdatePassCnt()                                              { return m_UpdatePassCnt; }
+    int GetLinkRunCnt()                                                 { return m_LinkRunCnt; }
     void ForceUpdate( );
+    void InvalidateIndex()                                              { m_IndexValid = false; }
     void SetActiveLink( AdvLink* adv_link )                             { m_ActiveLink = adv_link; }
 
     AdvLink* GetLink( int index );
@@ -68,10 +81,27 @@ private:
     AdvLinkMgrSingleton& operator=( AdvLinkMgrSingleton const& copy );  // Not Implemented
 
     void AddInputOutput( const string & parm_id, const string & var_name, bool input_flag );
+    void BuildIndex();
+
     int m_EditLinkIndex;
     AdvLink* m_ActiveLink;
     vector< AdvLink* > m_LinkVec;
 
+    //==== Parm ID -> Link Indices, Rebuilt When Links Or Their Vars Change ====//
+    bool m_IndexValid;
+    int m_IndexFreeCnt;                                         // ParmMgr Handle Free Count When Built
+    unordered_map< int, vector< int > > m_InputLinkMap;         // Parm Handle -> Link Indices
+    unordered_map< int, vector< int > > m_OutputLinkMap;
+    vector< int > m_LinkRank;                       // Topological Position Of Each Link
+    vector< vector< int > > m_LinkOutputVec;        // Link Index -> Output Parm Handles
+
+    //==== Links Waiting To Run In The Current Update Pass ( Rank, Index ) ====//
+    bool m_UpdatingFlag;
+    std::set< std::pair< int, int > > m_PendingLinkSet;
+    std::set< int > m_RunLinkSet;
+    int m_UpdatePassCnt;                            // Passes Opened, For Profiling And Tests
+    int m_LinkRunCnt;                               // Links Run By Passes
+
 };
 
 #define AdvLinkMgr AdvLinkMgrSingleton::getInstance()
@@ -15,6 +15,15 @@
 
 #include "VSPAEROMgr.h"
 #include "ParasiteDragMgr.h"
+#include "DesignVarMgr.h"
+#include "ParmMgr.h"
+#include "StringUtil.h"
+#include "FileUtil.h"
+#include "ProcessUtil.h"
+
+#include <set>
+#include <limits>
+#include <thread>
 
 void RWCollection::Clear()
 {
@@ -467,6 +476,10 @@ void AnalysisMgrSingleton::RegisterBuiltins()
     CpSlicerAnalysis *cpsa = new CpSlicerAnalysis();
 
     RegisterAnalysis( "CpSlicer", cpsa );
+
+    DesignVarGradientAnalysis *dvga = new DesignVarGradientAnalysis();
+
+    RegisterAnalysis( "DesignVarGradient", dvga );
 }
 
 //======================================================================================//
@@ -703,6 +716,7 @@ void PlanarSliceAnalysis::SetDefaults()
     m_Inputs.Add( NameValData( "AutoBoundFlag", 1 ) );
     m_Inputs.Add( NameValData( "StartVal", 0.0 ) );
     m_Inputs.Add( NameValData( "EndVal", 10.0 ) );
+    m_Inputs.Add( NameValData( "DirectSectionFlag", 0 ) );
 }
 
 string PlanarSliceAnalysis::Execute()
@@ -718,6 +732,7 @@ string PlanarSliceAnalysis::Execute()
         vec3d axis( 1.0, 0.0, 0.0 );
         bool autobnd = true;
         double start = 0.0, end = 10.0;
+        bool direct = false;
 
         NameValData *nvd = NULL;
 
@@ -765,7 +780,13 @@ string PlanarSliceAnalysis::Execute()
             end = nvd->GetDouble( 0 );
         }
 
-        string geom = veh->PSliceAndFlatten( geomSet, numSlice,  axis,  autobnd,  start,  end  );
+        nvd = m_Inputs.FindPtr( "DirectSectionFlag", 0 );
+        if ( nvd )
+        {
+            direct = ( nvd->GetInt( 0 ) == 1 );
+        }
+
+        string geom = veh->PSliceAndFlatten( geomSet, numSlice,  axis,  autobnd,  start,  end, direct );
 
         res = ResultsMgr.FindLatestResultsID( "Slice" );
     }
@@ -1989,4 +2010,606 @@ string CpSlicerAnalysis::Execute()
     }
 
     return res_id;
-}
\ No newline at end of file
+}
+
+//======================================================================================//
+//=============================== DesignVar Gradient ===================================//
+//======================================================================================//
+
+void DesignVarGradientAnalysis::SetDefaults()
+{
+    m_Inputs.Clear();
+    m_Inputs.Add( NameValData( "Analysis", string( "CompGeom" ) ) );
+    m_Inputs.Add( NameValData( "Outputs", vector< string >() ) );   // Empty For All Double And Vec3d Data
+    m_Inputs.Add( NameValData( "RelStep", 1.0e-4 ) );
+    m_Inputs.Add( NameValData( "CentralFlag", 1 ) );
+    m_Inputs.Add( NameValData( "NCPU", std::max( ( int )std::thread::hardware_concurrency(), 1 ) ) );
+
+    // Set by the parent when this process is a perturbation worker
+    m_Inputs.Add( NameValData( "WorkerParmID", string() ) );
+    m_Inputs.Add( NameValData( "WorkerVal", 0.0 ) );
+    m_Inputs.Add( NameValData( "WorkerFile", string() ) );
+}
+
+string DesignVarGradientAnalysis::Execute()
+{
+    string res_id;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+
+    if ( !veh )
+    {
+        return res_id;
+    }
+
+    string analysis = "CompGeom";
+    vector< string > out_names;
+    double rel_step = 1.0e-4;
+    bool central_flag = true;
+    int ncpu = 1;
+    string worker_parm_id;
+    double worker_val = 0.0;
+    string worker_file;
+
+    NameValData *nvd = NULL;
+
+    nvd = m_Inputs.FindPtr( "Analysis", 0 );
+    if ( nvd )
+    {
+        analysis = nvd->GetString( 0 );
+    }
+
+    nvd = m_Inputs.FindPtr( "Outputs", 0 );
+    if ( nvd )
+    {
+        out_names = nvd->GetStringData();
+    }
+
+    nvd = m_Inputs.FindPtr( "RelStep", 0 );
+    if ( nvd )
+    {
+        rel_step = nvd->GetDouble( 0 );
+    }
+
+    nvd = m_Inputs.FindPtr( "CentralFlag", 0 );
+    if ( nvd )
+    {
+        central_flag = !!nvd->GetInt( 0 );
+    }
+
+    nvd = m_Inputs.FindPtr( "NCPU", 0 );
+    if ( nvd )
+    {
+        ncpu = std::max( nvd->GetInt( 0 ), 1 );
+    }
+
+    nvd = m_Inputs.FindPtr( "WorkerParmID", 0 );
+    if ( nvd )
+    {
+        worker_parm_id = nvd->GetString( 0 );
+    }
+
+    nvd = m_Inputs.FindPtr( "WorkerVal", 0 );
+    if ( nvd )
+    {
+        worker_val = nvd->GetDouble( 0 );
+    }
+
+    nvd = m_Inputs.FindPtr( "WorkerFile", 0 );
+    if ( nvd )
+    {
+        worker_file = nvd->GetString( 0 );
+    }
+
+    if ( analysis == "DesignVarGradient" || !AnalysisMgr.FindAnalysis( analysis ) )
+    {
+        printf( "ERROR - invalid analysis to differentiate: %s\n", analysis.c_str() );
+        return res_id;
+    }
+
+    if ( !worker_file.empty() )
+    {
+        return ExecuteWorker( analysis, out_names, worker_parm_id, worker_val, worker_file );
+    }
+
+    if ( veh->GetVSPScriptCmd().empty() )
+    {
+        printf( "ERROR - vspscript not found in %s, gradient worker processes can not be run\n", veh->GetExePath().c_str() );
+        return res_id;
+    }
+
+    //==== Collect Design Var Parms ====//
+    vector< Parm* > parm_vec;
+    vector< string > var_id_vec;
+    vector< double > base_var_vec;
+    for ( int i = 0 ; i < DesignVarMgr.GetNumVars() ; i++ )
+    {
+        DesignVar* dv = DesignVarMgr.GetVar( i );
+        Parm* p = dv ? ParmMgr.FindParm( dv->m_ParmID ) : NULL;
+        if ( p )
+        {
+            parm_vec.push_back( p );
+            var_id_vec.push_back( p->GetID() );
+            base_var_vec.push_back( p->Get() );
+        }
+    }
+
+    int nvar = ( int )parm_vec.size();
+
+    //==== One Worker Per Perturbation - One Sided Steps Back When At Upper Limit ====//
+    vector< int > plus_job_vec( nvar, -1 );
+    vector< int > minus_job_vec( nvar, -1 );
+    vector< string > job_id_vec;
+    vector< double > job_val_vec;
+    for ( int j = 0 ; j < nvar ; j++ )
+    {
+        double x = base_var_vec[j];
+        double h = rel_step * std::max( std::abs( x ), 1.0 );
+        bool back_flag = !central_flag && x + h > parm_vec[j]->GetUpperLimit();
+
+        if ( !back_flag )
+        {
+            plus_job_vec[j] = ( int )job_val_vec.size();
+            job_id_vec.push_back( var_id_vec[j] );
+            job_val_vec.push_back( x + h );
+        }
+        if ( central_flag || back_flag )
+        {
+            minus_job_vec[j] = ( int )job_val_vec.size();
+            job_id_vec.push_back( var_id_vec[j] );
+            job_val_vec.push_back( x - h );
+        }
+    }
+
+    //==== Workers Start From The Current Vehicle Written To A Private Temp Dir ====//
+    string tmp_dir = MakeTempDir( "VSP_DVGrad" );
+    if ( tmp_dir.empty() )
+    {
+        printf( "ERROR - unable to create gradient worker directory\n" );
+        return res_id;
+    }
+
+    string base_name = tmp_dir + "DVGrad";
+    string vsp3_file = base_name + ".vsp3";
+    if ( !veh->WriteXMLFile( vsp3_file, vsp::SET_ALL ) )
+    {
+        printf( "ERROR - unable to write gradient worker file: %s\n", vsp3_file.c_str() );
+        RemoveDir( tmp_dir );
+        return res_id;
+    }
+
+    int njob = ( int )job_val_vec.size();
+    vector< string > script_file_vec( njob );
+    vector< string > out_file_vec( njob );
+    vector< bool > launch_vec( njob, false );
+    for ( int k = 0 ; k < njob ; k++ )
+    {
+        script_file_vec[k] = base_name + "_" + StringUtil::int_to_string( k, "%d" ) + ".vspscript";
+        out_file_vec[k] = base_name + "_" + StringUtil::int_to_string( k, "%d" ) + ".txt";
+        launch_vec[k] = WriteWorkerScript( script_file_vec[k], analysis, out_names, job_id_vec[k], job_val_vec[k], out_file_vec[k] );
+    }
+
+    //==== Save Show Sets And Selection - Mesh Analyses Hide Everything But Their Mesh ====//
+    vector< string > active_vec = veh->GetActiveGeomVec();
+    vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec( false ) );
+    vector< bool > shown_vec( geom_vec.size(), false );
+    vector< bool > not_shown_vec( geom_vec.size(), false );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i] )
+        {
+            shown_vec[i] = geom_vec[i]->GetSetFlag( vsp::SET_SHOWN );
+            not_shown_vec[i] = geom_vec[i]->GetSetFlag( vsp::SET_NOT_SHOWN );
+        }
+    }
+
+    //==== Keep NCPU Workers Running - Base Point Is Evaluated Here While The First Batch Runs ====//
+    vector< ProcessUtil > proc_vec( njob );
+    vector< ProcessUtil* > proc_ptr_vec( njob );
+    for ( int k = 0 ; k < njob ; k++ )
+    {
+        proc_ptr_vec[k] = &proc_vec[k];
+    }
+
+    vector< double > base_out_vec;
+    vector< string > out_label_vec;
+    bool base_ok = false;
+    bool base_flag = false;
+    int next_job = 0;
+    int nrun = 0;
+
+    while ( !base_flag || next_job < njob || nrun > 0 )
+    {
+        while ( next_job < njob && nrun < ncpu )
+        {
+            if ( launch_vec[next_job] )
+            {
+                vector< string > args;
+                args.push_back( vsp3_file );
+                args.push_back( "-script" );
+                args.push_back( script_file_vec[next_job] );
+
+                proc_vec[next_job].ForkCmd( veh->GetExePath(), veh->GetVSPScriptCmd(), args );
+                nrun++;
+            }
+            next_job++;
+        }
+
+        if ( !base_flag )
+        {
+            base_ok = EvalOutputs( analysis, out_names, base_out_vec, out_label_vec );
+            base_flag = true;
+        }
+
+        //==== Sleep Until A Worker Exits - Its Slot Goes To The Next Job ====//
+        if ( nrun > 0 )
+        {
+            int k = ProcessUtil::WaitForAnyExit( proc_ptr_vec );
+            if ( k < 0 )
+            {
+                nrun = 0;
+            }
+            else
+            {
+                proc_vec[k].CloseStdoutPipe();
+                nrun--;
+            }
+        }
+    }
+
+    //==== Restore Show Sets And Selection ====//
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i] )
+        {
+            geom_vec[i]->SetSetFlag( vsp::SET_SHOWN, shown_vec[i] );
+            geom_vec[i]->SetSetFlag( vsp::SET_NOT_SHOWN, not_shown_vec[i] );
+        }
+    }
+    veh->SetActiveGeomVec( active_vec );
+
+    //==== Gather Worker Outputs ====//
+    vector< double > job_var_vec( njob, 0.0 );
+    vector< vector< double > > job_out_vec( njob );
+    vector< bool > job_ok_vec( njob, false );
+    for ( int k = 0 ; k < njob ; k++ )
+    {
+        if ( launch_vec[k] )
+        {
+            job_ok_vec[k] = ReadWorkerFile( out_file_vec[k], job_var_vec[k], job_out_vec[k] );
+        }
+    }
+    RemoveDir( tmp_dir );
+
+    if ( !base_ok )
+    {
+        return res_id;
+    }
+
+    int nout = ( int )base_out_vec.size();
+
+    //==== Columns Stay NaN When A Worker Failed, Outputs Changed Size, Or The Var Did Not Move ====//
+    vector< vector< double > > jac_mat( nout, vector< double >( nvar, std::numeric_limits< double >::quiet_NaN() ) );
+    vector< double > step_vec( nvar, 0.0 );
+    vector< int > valid_vec( nvar, 0 );
+
+    for ( int j = 0 ; j < nvar ; j++ )
+    {
+        double xp = base_var_vec[j];
+        double xm = base_var_vec[j];
+        vector< double > fp_vec = base_out_vec;
+        vector< double > fm_vec = base_out_vec;
+        bool ok = true;
+
+        int kp = plus_job_vec[j];
+        if ( kp >= 0 )
+        {
+            ok = job_ok_vec[kp] && ok;
+            xp = job_var_vec[kp];
+            fp_vec = job_out_vec[kp];
+        }
+
+        int km = minus_job_vec[j];
+        if ( km >= 0 )
+        {
+            ok = job_ok_vec[km] && ok;
+            xm = job_var_vec[km];
+            fm_vec = job_out_vec[km];
+        }
+
+        double dx = xp - xm;
+        step_vec[j] = dx;
+
+        if ( ok && dx != 0.0 && ( int )fp_vec.size() == nout && ( int )fm_vec.size() == nout )
+        {
+            for ( int i = 0 ; i < nout ; i++ )
+            {
+                jac_mat[i][j] = ( fp_vec[i] - fm_vec[i] ) / dx;
+            }
+            valid_vec[j] = 1;
+        }
+    }
+
+    //==== One Jacobian Row Per Output ====//
+    Results* res = ResultsMgr.CreateResults( "DesignVar_Gradient" );
+    if ( res )
+    {
+        res->Add( NameValData( "Analysis", analysis ) );
+        res->Add( NameValData( "Var_ID", var_id_vec ) );
+        res->Add( NameValData( "Var_Val", base_var_vec ) );
+        res->Add( NameValData( "Var_Step", step_vec ) );
+        res->Add( NameValData( "Var_Valid", valid_vec ) );
+        res->Add( NameValData( "Output_Name", out_label_vec ) );
+        res->Add( NameValData( "Output_Val", base_out_vec ) );
+        for ( int i = 0 ; i < nout ; i++ )
+        {
+            res->Add( NameValData( "Jacobian", jac_mat[i] ) );
+        }
+        res_id = res->GetID();
+    }
+
+    return res_id;
+}
+
+//==== Worker Side - Apply One Perturbation And Write The Realized Value And Outputs ====//
+string DesignVarGradientAnalysis::ExecuteWorker( const string & analysis, const vector< string > & out_names,
+                                                 const string & parm_id, double val, const string & out_file )
+{
+    vector< double > out_vals;
+    vector< string > out_labels;
+    double var_val = val;
+    bool ok = false;
+
+    Parm* p = ParmMgr.FindParm( parm_id );
+    if ( p )
+    {
+        p->Set( val );
+        var_val = p->Get();
+        ok = EvalOutputs( analysis, out_names, out_vals, out_labels );
+    }
+
+    FILE* fid = fopen( out_file.c_str(), "w" );
+    if ( fid )
+    {
+        fprintf( fid, "%d %.17g %d\n", ok ? 1 : 0, var_val, ( int )out_vals.size() );
+        for ( int i = 0 ; i < ( int )out_vals.size() ; i++ )
+        {
+            fprintf( fid, "%.17g\n", out_vals[i] );
+        }
+        fclose( fid );
+    }
+
+    return string();
+}
+
+//==== Quote A String As An AngelScript Literal ====//
+static string ScriptString( const string & str )
+{
+    string qstr = "\"";
+    for ( int i = 0 ; i < ( int )str.size() ; i++ )
+    {
+        if ( str[i] == '\\' || str[i] == '"' )
+        {
+            qstr.push_back( '\\' );
+        }
+        qstr.push_back( str[i] );
+    }
+    qstr.push_back( '"' );
+    return qstr;
+}
+
+//==== Write One Analysis Input As Script Statements ====//
+static void WriteScriptInput( FILE* fid, const string & analysis, const NameValData & data, int index, int & narr )
+{
+    string arr = "arr" + StringUtil::int_to_string( narr++, "%d" );
+    string func;
+
+    if ( data.GetType() == vsp::INT_DATA )
+    {
+        fprintf( fid, "    array< int > %s;\n", arr.c_str() );
+        for ( int i = 0 ; i < ( int )data.GetIntData().size() ; i++ )
+        {
+            fprintf( fid, "    %s.push_back( %d );\n", arr.c_str(), data.GetIntData()[i] );
+        }
+        func = "SetIntAnalysisInput";
+    }
+    else if ( data.GetType() == vsp::DOUBLE_DATA )
+    {
+        fprintf( fid, "    array< double > %s;\n", arr.c_str() );
+        for ( int i = 0 ; i < ( int )data.GetDoubleData().size() ; i++ )
+        {
+            fprintf( fid, "    %s.push_back( %.17g );\n", arr.c_str(), data.GetDoubleData()[i] );
+        }
+        func = "SetDoubleAnalysisInput";
+    }
+    else if ( data.GetType() == vsp::STRING_DATA )
+    {
+        fprintf( fid, "    array< string > %s;\n", arr.c_str() );
+        for ( int i = 0 ; i < ( int )data.GetStringData().size() ; i++ )
+        {
+            fprintf( fid, "    %s.push_back( %s );\n", arr.c_str(), ScriptString( data.GetStringData()[i] ).c_str() );
+        }
+        func = "SetStringAnalysisInput";
+    }
+    else if ( data.GetType() == vsp::VEC3D_DATA )
+    {
+        fprintf( fid, "    array< vec3d > %s;\n", arr.c_str() );
+        for ( int i = 0 ; i < ( int )data.GetVec3dData().size() ; i++ )
+        {
+            vec3d v = data.GetVec3dData()[i];
+            fprintf( fid, "    %s.push_back( vec3d( %.17g, %.17g, %.17g ) );\n", arr.c_str(), v.x(), v.y(), v.z() );
+        }
+        func = "SetVec3dAnalysisInput";
+    }
+    else
+    {
+        return;
+    }
+
+    fprintf( fid, "    %s( %s, %s, %s, %d );\n", func.c_str(), ScriptString( analysis ).c_str(),
+             ScriptString( data.GetName() ).c_str(), arr.c_str(), index );
+}
+
+//==== Worker Script - Copy The Analysis Inputs Then Run This Analysis In Worker Mode ====//
+bool DesignVarGradientAnalysis::WriteWorkerScript( const string & script_file, const string & analysis, const vector< string > & out_names,
+                                                   const string & parm_id, double val, const string & out_file )
+{
+    FILE* fid = fopen( script_file.c_str(), "w" );
+    if ( !fid )
+    {
+        printf( "ERROR - unable to write gradient worker script: %s\n", script_file.c_str() );
+        return false;
+    }
+
+    int narr = 0;
+
+    fprintf( fid, "void main()\n{\n" );
+
+    Analysis* a = AnalysisMgr.FindAnalysis( analysis );
+    if ( a )
+    {
+        vector< string > names = a->m_Inputs.GetAllDataNames();
+        for ( int i = 0 ; i < ( int )names.size() ; i++ )
+        {
+            for ( int index = 0 ; index < a->m_Inputs.GetNumData( names[i] ) ; index++ )
+            {
+                NameValData* data = a->m_Inputs.FindPtr( names[i], index );
+                if ( data )
+                {
+                    WriteScriptInput( fid, analysis, *data, index, narr );
+                }
+            }
+        }
+    }
+
+    vector< NameValData > worker_inputs;
+    worker_inputs.push_back( NameValData( "Analysis", analysis ) );
+    worker_inputs.push_back( NameValData( "Outputs", out_names ) );
+    worker_inputs.push_back( NameValData( "WorkerParmID", parm_id ) );
+    worker_inputs.push_back( NameValData( "WorkerVal", val ) );
+    worker_inputs.push_back( NameValData( "WorkerFile", out_file ) );
+    for ( int i = 0 ; i < ( int )worker_inputs.size() ; i++ )
+    {
+        WriteScriptInput( fid, "DesignVarGradient", worker_inputs[i], 0, narr );
+    }
+
+    fprintf( fid, "    ExecAnalysis( \"DesignVarGradient\" );\n" );
+    fprintf( fid, "}\n" );
+
+    fclose( fid );
+    return true;
+}
+
+//==== Read Realized Var Value And Flattened Outputs Written By A Worker ====//
+bool DesignVarGradientAnalysis::ReadWorkerFile( const string & out_file, double & var_val, vector< double > & out_vals )
+{
+    out_vals.clear();
+
+    FILE* fid = fopen( out_file.c_str(), "r" );
+    if ( !fid )
+    {
+        return false;
+    }
+
+    int ok = 0;
+    int n = 0;
+    bool read_ok = ( fscanf( fid, "%d %lf %d", &ok, &var_val, &n ) == 3 );
+
+    for ( int i = 0 ; i < n && read_ok ; i++ )
+    {
+        double v = 0.0;
+        read_ok = ( fscanf( fid, "%lf", &v ) == 1 );
+        out_vals.push_back( v );
+    }
+
+    fclose( fid );
+
+    return read_ok && ok == 1;
+}
+
+//==== Run Analysis And Flatten Named Outputs - Drops The Results And Any Geoms It Made ====//
+bool DesignVarGradientAnalysis::EvalOutputs( const string & analysis, const vector< string > & out_names,
+                                             vector< double > & out_vals, vector< string > & out_labels )
+{
+    out_vals.clear();
+    out_labels.clear();
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return false;
+    }
+
+    vector< string > pre_geom_vec = veh->GetGeomVec( false );
+
+    string rid = AnalysisMgr.ExecAnalysis( analysis );
+    Results* res = ResultsMgr.FindResultsPtr( rid );
+
+    bool ok = ( res != NULL );
+    if ( res )
+    {
+        bool all_flag = out_names.empty();
+        vector< string > names = all_flag ? res->GetAllDataNames() : out_names;
+
+        for ( int i = 0 ; i < ( int )names.size() ; i++ )
+        {
+            NameValData* data = res->FindPtr( names[i] );
+            if ( !data )
+            {
+                ok = false;
+                continue;
+            }
+
+            if ( data->GetType() == vsp::DOUBLE_DATA || ( data->GetType() == vsp::INT_DATA && !all_flag ) )
+            {
+                bool int_flag = ( data->GetType() == vsp::INT_DATA );
+                int n = int_flag ? ( int )data->GetIntData().size() : ( int )data->GetDoubleData().size();
+                for ( int k = 0 ; k < n ; k++ )
+                {
+                    out_vals.push_back( int_flag ? ( double )data->GetInt( k ) : data->GetDouble( k ) );
+                    out_labels.push_back( n == 1 ? names[i] : names[i] + "_" + StringUtil::int_to_string( k, "%d" ) );
+                }
+            }
+            else if ( data->GetType() == vsp::VEC3D_DATA )
+            {
+                const vector< vec3d > & v_vec = data->GetVec3dData();
+                int n = ( int )v_vec.size();
+                for ( int k = 0 ; k < n ; k++ )
+                {
+                    string label = ( n == 1 ) ? names[i] : names[i] + "_" + StringUtil::int_to_string( k, "%d" );
+                    out_vals.push_back( v_vec[k].x() );
+                    out_vals.push_back( v_vec[k].y() );
+                    out_vals.push_back( v_vec[k].z() );
+                    out_labels.push_back( label + "_x" );
+                    out_labels.push_back( label + "_y" );
+                    out_labels.push_back( label + "_z" );
+                }
+            }
+            else if ( !all_flag )
+            {
+                ok = false;
+            }
+        }
+
+        ResultsMgr.DeleteResult( rid );
+    }
+
+    //==== Remove Mesh Geoms Left Behind By The Analysis ====//
+    std::set< string > pre_geom_set( pre_geom_vec.begin(), pre_geom_vec.end() );
+    vector< string > post_geom_vec = veh->GetGeomVec( false );
+    vector< string > del_vec;
+    for ( int i = 0 ; i < ( int )post_geom_vec.size() ; i++ )
+    {
+        if ( pre_geom_set.find( post_geom_vec[i] ) == pre_geom_set.end() )
+        {
+            del_vec.push_back( post_geom_vec[i] );
+        }
+    }
+
+    if ( !del_vec.empty() )
+    {
+        veh->DeleteGeomVec( del_vec );
+    }
+
+    return ok;
+}
@@ -21,6 +21,8 @@ using std::map;
 using std::vector;
 using std::string;
 
+class Parm;
+
 //=== RWCollection ===//
 
 class RWCollection : public NameValCollection
@@ -225,5 +227,25 @@ class CpSlicerAnalysis : public Analysis
     virtual void SetDefaults();
     virtual string Execute();
 
+};
+
+//==== Finite Difference Jacobian Of Another Analysis's Outputs WRT The Design Vars - Perturbations Run In vspscript Workers ====//
+class DesignVarGradientAnalysis : public Analysis
+{
+public:
+
+    virtual void SetDefaults();
+    virtual string Execute();
+
+protected:
+
+    string ExecuteWorker( const string & analysis, const vector< string > & out_names,
+                          const string & parm_id, double val, const string & out_file );
+    bool WriteWorkerScript( const string & script_file, const string & analysis, const vector< string > & out_names,
+                            const string & parm_id, double val, const string & out_file );
+    bool ReadWorkerFile( const string & out_file, double & var_val, vector< double > & out_vals );
+    bool EvalOutputs( const string & analysis, const vector< string > & out_names,
+                      vector< double > & out_vals, vector< string > & out_labels );
+
 };
 #endif // !defined(ANALYSISMGR__INCLUDED_)
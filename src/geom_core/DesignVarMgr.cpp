@@ -258,6 +258,8 @@ void DesignVarMgrSingleton::ReadDesVarsDES( const string &newfile )
         DelAllVars();
         ResetWorkingVar();
 
+        ParmMgr.BeginTransaction();
+
         for ( int i = 0 ; i < nparm ; i++ )
         {
             fgets( temp, 255, fp );
@@ -283,8 +285,8 @@ void DesignVarMgrSingleton::ReadDesVarsDES( const string &newfile )
                 AddVar( id, vsp::XDDM_VAR );
             }
         }
-        // Trigger update.
-        VehicleMgr.GetVehicle()->Update();
+        // Propagate links and update once.
+        ParmMgr.CommitTransaction();
     }
     fclose( fp );
 }
@@ -374,6 +376,8 @@ void DesignVarMgrSingleton::ReadDesVarsXDDM( const string &newfile )
 
     int num_tot = num_v + num_c;
 
+    ParmMgr.BeginTransaction();
+
     for ( int i = 0 ; i < num_tot ; i++ )
     {
         xmlNodePtr var_node = vlist[i];
@@ -406,8 +410,8 @@ void DesignVarMgrSingleton::ReadDesVarsXDDM( const string &newfile )
         }
     }
 
-    // Trigger update.
-    VehicleMgr.GetVehicle()->Update();
+    // Propagate links and update once.
+    ParmMgr.CommitTransaction();
 
     //===== Free Doc =====//
     xmlFreeDoc( doc );
@@ -115,7 +115,7 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
 {
     if ( parm_ptr )
     {
-        m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+        m_UpdatedParmVec.push_back( parm_ptr->GetHandle() );
     }
 
     if ( type == Parm::SET )
@@ -150,9 +150,17 @@ void GeomBase::ForceUpdate()
 //==== Check If Parm Is In Updated ParmVec ====//
 bool GeomBase::UpdatedParm( const string & id )
 {
+    return UpdatedParm( ParmMgr.FindHandle( id ) );
+}
+
+bool GeomBase::UpdatedParm( int handle )
+{
+    if ( handle < 0 )
+        return false;
+
     for ( int i = 0 ; i < (int)m_UpdatedParmVec.size() ; i++ )
     {
-        if ( m_UpdatedParmVec[i] == id )
+        if ( m_UpdatedParmVec[i] == handle )
             return true;
     }
 
@@ -252,6 +260,7 @@ bool GeomBase::IsMatch( const string& id_string )
 void GeomBase::RemoveChildID( string id )
 {
     vector_remove_val( m_ChildIDVec, id );
+    m_LateUpdateFlag = true;
 }
 
 ////==== Copy Geometry ====//
@@ -746,6 +755,11 @@ void GeomXForm::AcceptScale()
 Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
+    m_TMeshTessValid = false;
+    m_TessSerialNum = 0;
+    m_UpdateCnt = 0;
+    m_FullUpdatePending = false;
+    m_DrawObjValid = false;
 
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
@@ -975,6 +989,8 @@ void Geom::Update( bool fullupdate )
     m_LateUpdateFlag = false;
 
     m_CappingDone = false;
+    m_TMeshTessValid = false;
+    m_TessSerialNum++;
 
     Scale();
 
@@ -1013,13 +1029,40 @@ void Geom::Update( bool fullupdate )
 
     if ( fullupdate )
     {
-        UpdateDrawObj();
+        m_DrawObjValid = false;     // Rebuilt by ValidateDrawObj when something draws
     }
 
+    //==== Parms Set By This Update Are Outputs, Not New Inputs ====//
+    m_LateUpdateFlag = false;
+    m_UpdateCnt = ParmMgr.GetLatestChangeCnt();
+    m_FullUpdatePending = !fullupdate;
+
     m_UpdatedParmVec.clear();
     m_UpdateBlock = false;
 }
 
+//==== Update Changed Geoms And Their Descendants - Same Calls A Full Update Would Make ====//
+void Geom::UpdateChanged( bool fullupdate, const std::set< string > & changed_id_set )
+{
+    //==== Geoms Dirtied Earlier In This Pass (e.g. Link Targets Of Outputs) Are Flagged Late ====//
+    if ( changed_id_set.count( GetID() ) || m_LateUpdateFlag )
+    {
+        Update( fullupdate );
+        return;
+    }
+
+    for ( int i = 0 ; i < (int)m_ChildIDVec.size() ; i++ )
+    {
+        Geom* child = m_Vehicle->FindGeom( m_ChildIDVec[i] );
+        if ( child )
+        {
+            child->m_ignoreAbsFlag = true;
+            child->UpdateChanged( fullupdate, changed_id_set );
+            child->m_ignoreAbsFlag = false;
+        }
+    }
+}
+
 void Geom::GetUWTess01( int indx, vector < double > &u, vector < double > &w )
 {
     vector< vector< vec3d > > pnts;
@@ -3706,33 +3749,51 @@ void Geom::WritePovRayTri( FILE* fid, const vec3d& v, const vec3d& n, bool comma
 vector< TMesh* > Geom::CreateTMeshVec()
 {
     vector< TMesh* > TMeshVec;
-    vector< vector<vec3d> > pnts;
     vector< vector<vec3d> > norms;
-    vector< vector<vec3d> > uw_pnts;
     double tol=1.0e-12;
 
-    for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
+    //==== Surfaces Only Change In Update, So Repeated CompGeoms Reuse The Tesselation ====//
+    if ( !m_TMeshTessValid || m_TMeshPntCache.size() != m_SurfVec.size() )
     {
-        m_SurfVec[i].ResetUWSkip();
-    }
+        m_TMeshPntCache.clear();
+        m_TMeshUWCache.clear();
+        m_TMeshPntCache.resize( m_SurfVec.size() );
+        m_TMeshUWCache.resize( m_SurfVec.size() );
 
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() - 1 ; i++ )
-    {
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
+        for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
+        {
+            m_SurfVec[i].ResetUWSkip();
+        }
+
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() - 1 ; i++ )
         {
-            if ( m_SurfIndxVec[i] == m_SurfIndxVec[j] )
+            for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
             {
-                m_SurfVec[i].FlagDuplicate( &m_SurfVec[j] );
+                if ( m_SurfIndxVec[i] == m_SurfIndxVec[j] )
+                {
+                    m_SurfVec[i].FlagDuplicate( &m_SurfVec[j] );
+                }
+            }
+        }
+
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        {
+            if ( m_SurfVec[i].GetNumSectU() != 0 && m_SurfVec[i].GetNumSectW() != 0 )
+            {
+                UpdateTesselate( i, m_TMeshPntCache[i], norms, m_TMeshUWCache[i], false );
+                m_SurfVec[i].ResetUWSkip(); // Done with skip flags.
             }
         }
+
+        m_TMeshTessValid = true;
     }
 
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if ( m_SurfVec[i].GetNumSectU() != 0 && m_SurfVec[i].GetNumSectW() != 0 )
         {
-            UpdateTesselate( i, pnts, norms, uw_pnts, false );
-            m_SurfVec[i].ResetUWSkip(); // Done with skip flags.
+            const vector< vector<vec3d> > & pnts = m_TMeshPntCache[i];
+            const vector< vector<vec3d> > & uw_pnts = m_TMeshUWCache[i];
 
             TMeshVec.push_back( new TMesh() );
             int itmesh = TMeshVec.size() - 1;
@@ -3877,6 +3938,7 @@ void Geom::DelSubSurf( int ind )
     {
         delete m_SubSurfVec[ind];
         m_SubSurfVec.erase( m_SubSurfVec.begin() + ind );
+        m_LateUpdateFlag = true;
     }
 
     SubSurfaceMgr.ReSuffixGroupNames( GetID() );
@@ -4015,6 +4077,7 @@ FeaStructure* Geom::AddFeaStruct( bool initskin, int surf_index )
 
             m_FeaStructVec.push_back( feastruct );
             m_FeaStructCount++;
+            m_LateUpdateFlag = true;
         }
     }
 
@@ -4038,6 +4101,7 @@ void Geom::DeleteFeaStruct( int index )
 
     delete m_FeaStructVec[index];
     m_FeaStructVec.erase( m_FeaStructVec.begin() + index );
+    m_LateUpdateFlag = true;
 }
 
 bool Geom::ValidGeomFeaStructInd( int index )
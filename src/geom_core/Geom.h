@@ -35,6 +35,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 
 class XSecSurf;
 
@@ -207,9 +208,11 @@ public:
     virtual int CountParents( int count );
     virtual bool IsParentJoint();
 
+    //==== Hierarchy Changes Move The Geom Without Changing A Parm ====//
     virtual void SetParentID( string id )
     {
         m_ParentID = id ;
+        m_LateUpdateFlag = true;
     }
     virtual string GetParentID()
     {
@@ -220,6 +223,7 @@ public:
     virtual void AddChildID( string id )
     {
         m_ChildIDVec.push_back( id );
+        m_LateUpdateFlag = true;
     }
     virtual void RemoveChildID( string id );
     virtual vector< string > GetChildIDVec()
@@ -229,9 +233,11 @@ public:
     virtual void SetChildIDVec( vector< string > & vec )
     {
         m_ChildIDVec = vec;
+        m_LateUpdateFlag = true;
     }
 
     virtual bool UpdatedParm( const string & id );
+    virtual bool UpdatedParm( int handle );
 
     virtual void LoadIDAndChildren( vector< string > & id_vec, bool check_display_flag = false );
 
@@ -251,7 +257,7 @@ protected:
     string m_ParentID;                                  // ID of Parent (NONE == No Parent)
     vector< string > m_ChildIDVec;                      // Children ID
 
-    vector< string > m_UpdatedParmVec;
+    vector< int > m_UpdatedParmVec;         // Interned IDs Of Parms Set Since The Last Update
 };
 
 //==== Geom XForm ====//
@@ -349,6 +355,39 @@ public:
     virtual ~Geom();
 
     virtual void Update( bool fullupdate = true );
+    virtual void UpdateChanged( bool fullupdate, const std::set< string > & changed_id_set );
+    virtual bool GetDrawObjValid()
+    {
+        return m_DrawObjValid;
+    }
+    virtual void InvalidateDrawObj()
+    {
+        m_DrawObjValid = false;     // GuiDraw settings read by UpdateDrawObj changed
+    }
+    virtual void ValidateDrawObj()
+    {
+        if ( !m_DrawObjValid )
+        {
+            UpdateDrawObj();
+            m_DrawObjValid = true;
+        }
+    }
+    virtual int GetUpdateCnt()
+    {
+        return m_UpdateCnt;
+    }
+    virtual void SetUpdateCnt( int cnt )
+    {
+        m_UpdateCnt = cnt;
+    }
+    virtual bool GetFullUpdatePending()
+    {
+        return m_FullUpdatePending;
+    }
+    virtual int GetTessSerialNum()
+    {
+        return m_TessSerialNum;
+    }
     virtual void LoadMainDrawObjs( vector< DrawObj* > & draw_obj_vec );
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -462,6 +501,7 @@ public:
     virtual void AddSubSurf( SubSurface* sub_surf )
     {
         m_SubSurfVec.push_back( sub_surf );
+        m_LateUpdateFlag = true;
     }
     virtual SubSurface* AddSubSurf( int type, int surfindex );
     virtual bool ValidSubSurfInd( int ind );
@@ -619,6 +659,10 @@ public:
     BoolParm m_CapUMaxSweepFlag;
     bool m_CappingDone;
 
+    int m_UpdateCnt;                    // ParmMgr change count when the last Update finished
+    bool m_FullUpdatePending;           // Last Update skipped feature lines, sub surfaces and draw objects
+    bool m_DrawObjValid;                // Draw objects match the current surfaces
+
     //==== Wake for CFD Mesh ====//
     BoolParm m_WakeActiveFlag;
 
@@ -674,6 +718,12 @@ protected:
     vector<VspSurf> m_SurfVec;
     vector<int> m_SurfIndxVec;
     vector< vector< int > > m_SurfSymmMap;
+
+    //==== CompGeom Tesselation Reused Until The Next Update ====//
+    bool m_TMeshTessValid;
+    int m_TessSerialNum;                // Bumped each time Update may have changed the surfaces
+    vector< vector< vector< vec3d > > > m_TMeshPntCache;
+    vector< vector< vector< vec3d > > > m_TMeshUWCache;
     vector< Matrix4d > m_FeaTransMatVec; // Vector of transformation matrixes
     vector<DrawObj> m_WireShadeDrawObj_vec;
     vector<DrawObj> m_FeatureDrawObj_vec;
@@ -405,6 +405,14 @@ void PointSimpleSource::Update( Geom* geomPtr )
     m_Loc = geomPtr->CompPnt01(m_SurfIndx, m_ULoc, m_WLoc);
 }
 
+bool PointSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_Loc );
+    box.Expand( m_Rad );
+    return true;
+}
+
 void PointSimpleSource::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
 {
     m_PointDO.m_PntVec = CreateSphere( m_Rad, m_Loc );
@@ -582,6 +590,13 @@ void LineSimpleSource::Update( Geom* geomPtr )
     SetEndPnts( p1, p2 );
 }
 
+bool LineSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    // Cone frustum between the end spheres is contained in m_Box
+    box = m_Box;
+    return true;
+}
+
 void LineSimpleSource::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
 {
     m_LineDO1.m_PntVec = CreateSphere( m_Rad, m_Pnt1 );
@@ -771,6 +786,14 @@ void BoxSimpleSource::Update( Geom* geomPtr )
 
 }
 
+bool BoxSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_CullMinPnt );
+    box.Update( m_CullMaxPnt );
+    return true;
+}
+
 void BoxSimpleSource::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
 {
     vector< vec3d > loop1 , loop2, lines;
@@ -189,6 +189,10 @@ public:
 
     virtual void Update( Geom* geomPtr )                            {}
 
+    // Region outside of which GetTargetLen always returns base_len.  Returns
+    // false if the source can not be bounded in x,y,z space.
+    virtual bool GetInfluenceBox( BndBox & box )                    { return false; }
+
     virtual void CopyFrom( BaseSource* s ) = 0;
 
     virtual vector< vec3d > CreateSphere( double rad, const vec3d& loc );
@@ -221,6 +225,8 @@ public:
 
     virtual void Update( Geom* geomPtr );
 
+    virtual bool GetInfluenceBox( BndBox & box );
+
     virtual void CopyFrom( BaseSource* s );
 
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -253,6 +259,8 @@ public:
 
     virtual void Update( Geom* geomPtr );
 
+    virtual bool GetInfluenceBox( BndBox & box );
+
     virtual void CopyFrom( BaseSource* s );
 
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -299,6 +307,8 @@ public:
 
     void Update( Geom* geomPtr );
 
+    virtual bool GetInfluenceBox( BndBox & box );
+
     double m_ULoc1;
     double m_WLoc1;
 
@@ -15,6 +15,9 @@
 Link::Link()
 {
     m_Name = "Link";
+    m_ParmAHandle = -1;
+    m_ParmBHandle = -1;
+    m_HandleFreeCnt = 0;
     m_OffsetFlag = true;
     m_ScaleFlag = false;
     m_LowerLimitFlag = false;
@@ -38,11 +41,30 @@ Link::~Link()
 void Link::SetParmA( string id  )
 {
     m_ParmA = id;
+    m_ParmAHandle = ParmMgr.InternID( m_ParmA );
 }
 
 void Link::SetParmB( string id )
 {
     m_ParmB = id;
+    m_ParmBHandle = ParmMgr.InternID( m_ParmB );
+}
+
+//==== Re-Intern IDs Once A Removed Parm May Have Made The Handles Stale ====//
+void Link::CheckHandles()
+{
+    if ( m_HandleFreeCnt != ParmMgr.GetHandleFreeCnt() )
+    {
+        m_HandleFreeCnt = ParmMgr.GetHandleFreeCnt();
+        if ( m_ParmAHandle >= 0 )
+        {
+            m_ParmAHandle = ParmMgr.InternID( m_ParmA );
+        }
+        if ( m_ParmBHandle >= 0 )
+        {
+            m_ParmBHandle = ParmMgr.InternID( m_ParmB );
+        }
+    }
 }
 
 void Link::InitOffsetScale()
@@ -102,8 +124,8 @@ xmlNodePtr Link::DecodeXml( xmlNodePtr & link_node )
 {
     if ( link_node )
     {
-        m_ParmA = ParmMgr.RemapID( XmlUtil::FindString( link_node, "ParmAID", string() ) );
-        m_ParmB = ParmMgr.RemapID( XmlUtil::FindString( link_node, "ParmBID", string() ) );
+        SetParmA( ParmMgr.RemapID( XmlUtil::FindString( link_node, "ParmAID", string() ) ) );
+        SetParmB( ParmMgr.RemapID( XmlUtil::FindString( link_node, "ParmBID", string() ) ) );
 
         m_Offset.DecodeXml( link_node );
         m_Scale.DecodeXml( link_node );
@@ -30,6 +30,8 @@ public:
     virtual void SetParmB( string id );
     virtual string GetParmA() const             { return m_ParmA; }
     virtual string GetParmB() const             { return m_ParmB; }
+    int GetParmAHandle()                        { CheckHandles(); return m_ParmAHandle; }
+    int GetParmBHandle()                        { CheckHandles(); return m_ParmBHandle; }
     virtual void InitOffsetScale();
 
     virtual void SetOffsetFlag( bool f )        { m_OffsetFlag = f; }
@@ -58,6 +60,11 @@ protected:
 
     string m_ParmA;
     string m_ParmB;
+    int m_ParmAHandle;                          // Interned IDs For Link Propagation
+    int m_ParmBHandle;
+    int m_HandleFreeCnt;                        // ParmMgr Free Count When Handles Were Interned
+
+    void CheckHandles();
 
     bool m_OffsetFlag;
     bool m_ScaleFlag;
@@ -19,6 +19,8 @@ bool LinkMgrSingleton::m_firsttime = true;
 LinkMgrSingleton::LinkMgrSingleton()
 {
     m_WorkingLink = NULL;
+    m_LinkIndexValid = false;
+    m_LinkIndexFreeCnt = 0;
     m_NumPredefinedUserParms = 16;
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
@@ -50,7 +52,7 @@ void LinkMgrSingleton::Wype()
     DelAllLinks();
     m_LinkVec = deque< Link* >();
 
-    m_UpdatedParmVec = vector< string >();
+    m_UpdatedParmVec = vector< int >();
 
     m_BaseLinkableContainers = vector< string >();
     m_LinkableContainers = vector< string >();
@@ -145,6 +147,7 @@ void LinkMgrSingleton::CheckLinks()
     {
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
     }
+    m_LinkIndexValid = false;
 
 }
 
@@ -233,6 +236,7 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
 
     m_LinkVec.push_back( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
+    m_LinkIndexValid = false;
 
     return true;
 }
@@ -248,6 +252,7 @@ void LinkMgrSingleton::DelCurrLink()
     Link* pl = m_LinkVec[m_CurrLinkIndex];
 
     m_LinkVec.erase( m_LinkVec.begin() +  m_CurrLinkIndex );
+    m_LinkIndexValid = false;
 
     delete pl;
 
@@ -263,6 +268,7 @@ void LinkMgrSingleton::DelAllLinks()
     }
 
     m_LinkVec.clear();
+    m_LinkIndexValid = false;
     m_CurrLinkIndex = -1;
 }
 //==== Link All Parms In A Group ====//
@@ -367,23 +373,27 @@ void LinkMgrSingleton::ResetWorkingLink()
 
 //==== Parm Changed ====//
 void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
+{
+    ParmChanged( ParmMgr.FindHandle( pid ), start_flag );
+}
+
+void LinkMgrSingleton::ParmChanged( int handle, bool start_flag  )
 {
     //==== Find Parm Ptr ===//
-    Parm* parm_ptr = ParmMgr.FindParm( pid );
+    Parm* parm_ptr = ParmMgr.FindParm( handle );
     if ( !parm_ptr )
         return;
 
     //==== Check For Advanced Links ====//
-    bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
+    bool adv_link_flag = AdvLinkMgr.IsInputParm( handle );
 
     //==== Look for Reg Links  ====//
+    BuildIndex();
     vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< int, vector< Link* > >::iterator it = m_ParmALinkMap.find( handle );
+    if ( it != m_ParmALinkMap.end() )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
-        {
-            parm_link_vec.push_back( m_LinkVec[i] );
-        }
+        parm_link_vec = it->second;
     }
 
     //==== Check Links ====//
@@ -399,13 +409,13 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 
     //==== Set Link Update Flag ====//
     parm_ptr->SetLinkUpdateFlag( true );
-    m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+    m_UpdatedParmVec.push_back( handle );
 
     //==== Update Linked Parms ====//
     for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
     {
         Link* pl = parm_link_vec[i];
-        Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+        Parm* pB = ParmMgr.FindParm( pl->GetParmBHandle() );
 
         if ( pB && ! pB->GetLinkUpdateFlag() )       // Prevent Circular
         {
@@ -439,21 +449,13 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     //==== Update Adv Link ===//
     if ( adv_link_flag )
     {
-        AdvLinkMgr.UpdateLinks( pid );
+        AdvLinkMgr.UpdateLinks( handle );
     }
 
     //==== Clean Up ====/
     if ( start_flag )      
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
-        {
-            Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( p )
-            {
-                p->SetLinkUpdateFlag( false );
-            }
-        }
-        m_UpdatedParmVec.clear();
+        ClearLinkUpdateFlags();
 
         Vehicle* veh = VehicleMgr.GetVehicle();
         if ( veh )
@@ -465,6 +467,114 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 
 
 
+//==== Index Links By Driving Parm - Keeps Link Order Within Each Parm ====//
+void LinkMgrSingleton::BuildIndex()
+{
+    if ( m_LinkIndexValid && m_LinkIndexFreeCnt == ParmMgr.GetHandleFreeCnt() )
+    {
+        return;
+    }
+
+    m_ParmALinkMap.clear();
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        m_ParmALinkMap[ m_LinkVec[i]->GetParmAHandle() ].push_back( m_LinkVec[i] );
+    }
+    m_LinkIndexValid = true;
+    m_LinkIndexFreeCnt = ParmMgr.GetHandleFreeCnt();
+}
+
+//==== Clear Circular Link Guards ====//
+void LinkMgrSingleton::ClearLinkUpdateFlags()
+{
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+        if ( p )
+        {
+            p->SetLinkUpdateFlag( false );
+        }
+    }
+    m_UpdatedParmVec.clear();
+}
+
+//==== Depth First Post Order Through Parms Driven By Reg And Adv Links ====//
+void LinkMgrSingleton::DrivenPostOrder( int handle, std::set< int > & visited_set, vector< int > & post_vec )
+{
+    if ( !visited_set.insert( handle ).second )
+    {
+        return;
+    }
+
+    vector< int > driven_vec;
+    unordered_map< int, vector< Link* > >::iterator it = m_ParmALinkMap.find( handle );
+    if ( it != m_ParmALinkMap.end() )
+    {
+        for ( int i = 0 ; i < ( int )it->second.size() ; i++ )
+        {
+            driven_vec.push_back( it->second[i]->GetParmBHandle() );
+        }
+    }
+    AdvLinkMgr.GetDrivenParms( handle, driven_vec );
+
+    for ( int i = 0 ; i < ( int )driven_vec.size() ; i++ )
+    {
+        DrivenPostOrder( driven_vec[i], visited_set, post_vec );
+    }
+    post_vec.push_back( handle );
+}
+
+//==== Parms Changed Together - Propagate Each Once, Upstream Parms First ====//
+// Parms set explicitly keep their values; links only drive parms outside the set.
+// Adv links share one pass, so a link reading several of the parms runs once.
+void LinkMgrSingleton::ParmsChanged( const vector< string > & pid_vec )
+{
+    vector< int > handle_vec;
+    for ( int i = 0 ; i < ( int )pid_vec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( pid_vec[i] );
+        if ( p )
+        {
+            handle_vec.push_back( p->GetHandle() );
+        }
+    }
+
+    //==== Reverse Post Order Is Topological - Seed In Reverse So Independent Parms Keep Set Order ====//
+    BuildIndex();
+    std::set< int > visited_set;
+    vector< int > post_vec;
+    for ( int i = ( int )handle_vec.size() - 1 ; i >= 0 ; i-- )
+    {
+        DrivenPostOrder( handle_vec[i], visited_set, post_vec );
+    }
+
+    std::set< int > changed_set( handle_vec.begin(), handle_vec.end() );
+
+    //==== Guard Explicit Values From Being Overwritten By Links ====//
+    for ( int i = 0 ; i < ( int )handle_vec.size() ; i++ )
+    {
+        ParmMgr.FindParm( handle_vec[i] )->SetLinkUpdateFlag( true );
+        m_UpdatedParmVec.push_back( handle_vec[i] );
+    }
+
+    bool pass_flag = AdvLinkMgr.BeginUpdatePass();
+
+    for ( int i = ( int )post_vec.size() - 1 ; i >= 0 ; i-- )
+    {
+        if ( changed_set.find( post_vec[i] ) != changed_set.end() )
+        {
+            ParmChanged( post_vec[i], false );
+        }
+    }
+
+    if ( pass_flag )
+    {
+        AdvLinkMgr.EndUpdatePass();
+    }
+
+    ClearLinkUpdateFlags();
+}
+
 void LinkMgrSingleton::SetParm( bool flagA, string parm_id )
 {
     if ( !ParmMgr.FindParm( parm_id ) )
@@ -733,9 +843,11 @@ bool LinkNameCompareB( const Link *lnkA, const Link *lnkB )
 void LinkMgrSingleton::SortLinksByA()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareA );
+    m_LinkIndexValid = false;
 }
 
 void LinkMgrSingleton::SortLinksByB()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareB );
+    m_LinkIndexValid = false;
 }
@@ -13,9 +13,12 @@
 
 #include "Link.h"
 #include <deque>
+#include <set>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Parm Link Manager ====//
@@ -44,8 +47,10 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); m_LinkIndexValid = false; }
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
+    virtual void ParmChanged( int handle, bool start_flag );            // Same By Interned Parm ID
+    virtual void ParmsChanged( const vector< string > & pid_vec );      // Parms Set In One Transaction
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
     virtual int  GetCurrLinkIndex()                         { return m_CurrLinkIndex; }
@@ -100,6 +105,9 @@ private:
 
     void Init();
     void Wype();
+    void ClearLinkUpdateFlags();
+    void BuildIndex();
+    void DrivenPostOrder( int handle, std::set< int > & visited_set, vector< int > & post_vec );
 
     int m_CurrLinkIndex;
     Link *m_WorkingLink;
@@ -108,7 +116,11 @@ private:
 
     deque< Link* > m_LinkVec;
 
-    vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
+    bool m_LinkIndexValid;
+    int m_LinkIndexFreeCnt;                 // ParmMgr Handle Free Count When Index Was Built
+    unordered_map< int, vector< Link* > > m_ParmALinkMap;        // ParmA Handle -> Links Driven By It, Rebuilt On Add/Del
+
+    vector< int > m_UpdatedParmVec;         // Keep Track Of Linked Parm To Prevent Circular Links
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
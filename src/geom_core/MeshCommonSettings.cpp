@@ -267,6 +267,11 @@ CfdMeshSettings::CfdMeshSettings() : MeshCommonSettings()
 
     m_XYZIntCurveFlag.Init( "SRF_XYZIntCurve", "ExportCFD", this, false, 0, 1 );
 
+    m_STLBinaryFlag.Init( "STL_Binary", "ExportCFD", this, false, 0, 1 );
+    m_STLBinaryFlag.SetDescript( "Write binary STL instead of ASCII" );
+    m_GmshBinaryFlag.Init( "GMSH_Binary", "ExportCFD", this, false, 0, 1 );
+    m_GmshBinaryFlag.SetDescript( "Write binary Gmsh 4.1 instead of ASCII Gmsh 2.2" );
+
     m_ExportRelCurveTol.Init( "ExportRelCurveTol", "ExportCFD", this, 0.01, 1e-6, 1.0 );
     m_ExportRawFlag.Init( "ExportRawFlag", "ExportCFD", this, false, 0, 1 );
 
@@ -220,6 +220,9 @@ public:
     BoolParm m_ExportFileFlags[vsp::CFD_NUM_FILE_NAMES];
     BoolParm m_XYZIntCurveFlag;
 
+    BoolParm m_STLBinaryFlag;
+    BoolParm m_GmshBinaryFlag;
+
 protected:
 
     // These file names do not get written to file.  They are reset each time
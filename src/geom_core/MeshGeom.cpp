@@ -469,17 +469,13 @@ void MeshGeom::WriteStl( FILE* file_id )
 void MeshGeom::WriteStl( FILE* file_id, int tag )
 {
     //==== Write Out Tris ====//
-    for ( int i = 0 ; i < ( int )m_IndexedTriVec.size() ; i++ )
+    for ( int i = 0 ; i < m_ExportIndex.NumTris() ; i++ )
     {
-        TTri* ttri = m_IndexedTriVec[i];
-
-        int t = SubSurfaceMgr.GetTag( ttri->m_Tags );
-
-        if ( t == tag )
+        if ( m_ExportIndex.m_TagVec[i] == tag )
         {
-            vec3d p0 = ttri->m_N0->m_Pnt;
-            vec3d p1 = ttri->m_N1->m_Pnt;
-            vec3d p2 = ttri->m_N2->m_Pnt;
+            const vec3d & p0 = m_ExportIndex.GetPnt( i, 0 );
+            const vec3d & p1 = m_ExportIndex.GetPnt( i, 1 );
+            const vec3d & p2 = m_ExportIndex.GetPnt( i, 2 );
             vec3d v10 = p1 - p0;
             vec3d v20 = p2 - p1;
             vec3d norm = cross( v10, v20 );
@@ -625,8 +621,7 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
 {
     int m, s, t;
 
-    m_IndexedTriVec.clear();
-    m_IndexedNodeVec.clear();
+    vector< TTri* > triVec;
 
     int mTMesh = (int) m_TMeshVec.size();
 
@@ -645,7 +640,7 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
                         char str[80];
                         sprintf( str, "%d", partOffset + m + 1 );
                         tri->m_SplitVec[s]->m_ID = string( str );
-                        m_IndexedTriVec.push_back( tri->m_SplitVec[s] );
+                        triVec.push_back( tri->m_SplitVec[s] );
                     }
                 }
             }
@@ -654,7 +649,7 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
                 char str[80];
                 sprintf( str, "%d", partOffset + m + 1 );
                 tri->m_ID = string( str );
-                m_IndexedTriVec.push_back( tri );
+                triVec.push_back( tri );
             }
         }
     }
@@ -673,7 +668,7 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
                         char str[80];
                         sprintf( str, "%d", partOffset + m + 1 + mTMesh );
                         tri->m_SplitVec[s]->m_ID = string( str );
-                        m_IndexedTriVec.push_back( tri->m_SplitVec[s] );
+                        triVec.push_back( tri->m_SplitVec[s] );
                     }
                 }
             }
@@ -682,81 +677,17 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
                 char str[80];
                 sprintf( str, "%d", partOffset + m + 1 + mTMesh );
                 tri->m_ID = string( str );
-                m_IndexedTriVec.push_back( tri );
+                triVec.push_back( tri );
             }
         }
     }
 
-    //==== Collect All Points ====//
-    vector< TNode* > allNodeVec;
-    allNodeVec.reserve( m_IndexedTriVec.size() * 3 );
-    for ( t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        m_IndexedTriVec[t]->m_N0->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N0 );
-        m_IndexedTriVec[t]->m_N1->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N1 );
-        m_IndexedTriVec[t]->m_N2->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N2 );
-    }
-    vector< vec3d > allPntVec( allNodeVec.size() );
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        allPntVec[i] = allNodeVec[i]->m_Pnt;
-    }
-
-    if ( allPntVec.size() == 0 )
-    {
-        return;
-    }
-
-    //==== Build Map ====//
-    PntNodeCloud pnCloud;
-    pnCloud.AddPntNodes( allPntVec );
-
     //==== Compute Tol ====//
     BndBox bb = m_Vehicle->GetBndBox();
     double tol = bb.GetLargestDist() * 1.0e-10;
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
-
-    //==== Load Used Nodes ====//
-    m_IndexedNodeVec.reserve( pnCloud.m_NumUsedPts );
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        if ( pnCloud.UsedNode( i ) )
-        {
-            m_IndexedNodeVec.push_back( allNodeVec[i] );
-        }
-    }
-
-    //==== Set Adjusted Node IDs ====//
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        allNodeVec[i]->m_ID = pnCloud.GetNodeUsedIndex( i );
-    }
-
-    //==== Remove Any Bogus Tris ====//
-    vector< TTri* > goodTriVec;
-    goodTriVec.reserve( m_IndexedTriVec.size() );
-    //==== Write Out Tris ====//
-    for ( t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            if ( ttri->m_N0->m_ID != ttri->m_N1->m_ID &&
-                    ttri->m_N0->m_ID != ttri->m_N2->m_ID &&
-                    ttri->m_N1->m_ID != ttri->m_N2->m_ID )
-            {
-                goodTriVec.push_back( ttri );
-            }
-        }
-    }
-    // Swap instead of assign to avoid copy.
-    // m_IndexedTriVec = goodTriVec;
-    swap( m_IndexedTriVec, goodTriVec );
+    //==== Merge Close Points, Drop Bogus Tris ====//
+    m_ExportIndex.Build( triVec, tol );
 
     Update();
 }
@@ -766,15 +697,11 @@ void MeshGeom::WriteNascartPnts( FILE* fp )
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
     //==== Write Out Nodes ====//
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_ExportIndex.NumPnts() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
-        }
+        v = XFormMat.xform( m_ExportIndex.m_PntVec[i] );
+        fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
     }
 }
 
@@ -783,15 +710,11 @@ void MeshGeom::WriteCart3DPnts( FILE* fp )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_ExportIndex.NumPnts() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
-        }
+        v = XFormMat.xform( m_ExportIndex.m_PntVec[i] );
+        fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
     }
 }
 
@@ -799,18 +722,14 @@ int MeshGeom::WriteGMshNodes( FILE* fp, int node_offset )
 {
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_ExportIndex.NumPnts() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + node_offset + 1,
-                     v.x(), v.y(), v.z() );
-        }
+        v = XFormMat.xform( m_ExportIndex.m_PntVec[i] );
+        fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + node_offset + 1,
+                 v.x(), v.y(), v.z() );
     }
-    return node_offset + ( int )m_IndexedNodeVec.size();
+    return node_offset + m_ExportIndex.NumPnts();
 }
 
 void MeshGeom::WriteFacetNodes( FILE* fp )
@@ -818,11 +737,10 @@ void MeshGeom::WriteFacetNodes( FILE* fp )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0; i < (int)m_IndexedNodeVec.size(); i++ )
+    for ( int i = 0; i < m_ExportIndex.NumPnts(); i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        v = XFormMat.xform( tnode->m_Pnt );
+        v = XFormMat.xform( m_ExportIndex.m_PntVec[i] );
         fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(), v.z() );
     }
 }
@@ -830,47 +748,37 @@ void MeshGeom::WriteFacetNodes( FILE* fp )
 int MeshGeom::WriteNascartTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_ExportIndex.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d %d.0\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N2->m_ID + 1 + off,
-                     ttri->m_N1->m_ID + 1 + off, SubSurfaceMgr.GetTag( ttri->m_Tags ) );
-        }
+        fprintf( fp, "%d %d %d %d.0\n", m_ExportIndex.GetTriNode( t, 0 ) + 1 + off,  m_ExportIndex.GetTriNode( t, 2 ) + 1 + off,
+                 m_ExportIndex.GetTriNode( t, 1 ) + 1 + off, m_ExportIndex.m_TagVec[t] );
     }
 
-    return ( off + m_IndexedNodeVec.size() );
+    return ( off + m_ExportIndex.NumPnts() );
 }
 
 int MeshGeom::WriteCart3DTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_ExportIndex.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
-        }
+        fprintf( fp, "%d %d %d\n", m_ExportIndex.GetTriNode( t, 0 ) + 1 + off,  m_ExportIndex.GetTriNode( t, 1 ) + 1 + off,
+                 m_ExportIndex.GetTriNode( t, 2 ) + 1 + off );
     }
 
-    return ( off + m_IndexedNodeVec.size() );
+    return ( off + m_ExportIndex.NumPnts() );
 }
 
 int MeshGeom::WriteGMshTris( FILE* fp, int node_offset, int tri_offset )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_ExportIndex.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d 2 0 %d %d %d\n", t + tri_offset + 1,
-                     ttri->m_N0->m_ID + 1 + node_offset,  ttri->m_N2->m_ID + 1 + node_offset, ttri->m_N1->m_ID + 1 + node_offset );
-        }
+        fprintf( fp, "%d 2 0 %d %d %d\n", t + tri_offset + 1,
+                 m_ExportIndex.GetTriNode( t, 0 ) + 1 + node_offset,  m_ExportIndex.GetTriNode( t, 2 ) + 1 + node_offset,
+                 m_ExportIndex.GetTriNode( t, 1 ) + 1 + node_offset );
     }
-    return ( tri_offset + m_IndexedTriVec.size() );
+    return ( tri_offset + m_ExportIndex.NumTris() );
 }
 
 void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &part_count )
@@ -888,15 +796,20 @@ void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &p
     int materialID = 0; // Default Material ID of PEC (Referred to as "iCoat" in XPatch facet file documentation)
 
     vector < int > all_tag_vec = SubSurfaceMgr.GetAllTags(); // vector of tags, where each tag identifies a part or group of facets
+    vector < int > tag_key_vec( all_tag_vec.size() ); // index of each tag in SubSurfaceMgr, for its name
+    for ( unsigned int i = 0; i < tag_key_vec.size(); i++ )
+    {
+        tag_key_vec[i] = i;
+    }
 
     //==== Get # of facets for each part ====//
     for ( unsigned int i = 0; i < all_tag_vec.size(); i++ )
     {
         int tag_count = 0;
 
-        for ( unsigned int j = 0; j < m_IndexedTriVec.size(); j++ )
+        for ( int j = 0; j < m_ExportIndex.NumTris(); j++ )
         {
-            if ( all_tag_vec[i] == SubSurfaceMgr.GetTag( m_IndexedTriVec[j]->m_Tags ) )
+            if ( all_tag_vec[i] == m_ExportIndex.m_TagVec[j] )
             {
                 tag_count++;
             }
@@ -913,6 +826,7 @@ void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &p
             // Erase to avoid writing and counting parts with no tris
             tri_offset.erase( tri_offset.begin() + j );
             all_tag_vec.erase( all_tag_vec.begin() + j );
+            tag_key_vec.erase( tag_key_vec.begin() + j );
             j--;
         }
     }
@@ -925,31 +839,30 @@ void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &p
         int curr_tag = all_tag_vec[i];
         bool new_section = true; // flag to write small part section header
 
-        for ( unsigned int j = 0; j < m_IndexedTriVec.size(); j++ )
+        for ( int j = 0; j < m_ExportIndex.NumTris(); j++ )
         {
-            if ( curr_tag == SubSurfaceMgr.GetTag( m_IndexedTriVec[j]->m_Tags ) ) // only write out current tris for surrent tag
+            if ( curr_tag == m_ExportIndex.m_TagVec[j] ) // only write out current tris for surrent tag
             {
                 if ( new_section ) // write small part header and get material ID for small part
                 {
-                    string name = SubSurfaceMgr.GetTagNames( m_IndexedTriVec[j]->m_Tags );
+                    string name = SubSurfaceMgr.GetTagNames( tag_key_vec[i] );
                     fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
                     fprintf( fp, "%d 3\n", tri_offset[i] ); // Number of facets for the part, 3 nodes per facet
 
                     new_section = false;
                 }
 
-                TTri* ttri = m_IndexedTriVec[j];
-
                 tri_count++; // counter for number of tris/facets
 
                 // 3 nodes of facet, material ID, component ID, running facet #:
-                fprintf( fp, "%d %d %d %d %d %d\n", ttri->m_N0->m_ID + 1 + offset, ttri->m_N1->m_ID + 1 + offset, ttri->m_N2->m_ID + 1 + offset, materialID, i + 1 + part_count, tri_count );
+                fprintf( fp, "%d %d %d %d %d %d\n", m_ExportIndex.GetTriNode( j, 0 ) + 1 + offset, m_ExportIndex.GetTriNode( j, 1 ) + 1 + offset,
+                         m_ExportIndex.GetTriNode( j, 2 ) + 1 + offset, materialID, i + 1 + part_count, tri_count );
             }
         }
     }
 
     part_count += tri_offset.size();
-    offset += m_IndexedNodeVec.size();
+    offset += m_ExportIndex.NumPnts();
 }
 
 int MeshGeom::WriteNascartParts( FILE* fp, int off )
@@ -965,12 +878,9 @@ int MeshGeom::WriteNascartParts( FILE* fp, int off )
 int MeshGeom::WriteCart3DParts( FILE* fp  )
 {
     //==== Write Component IDs for each Tri =====//
-    int tag;
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_ExportIndex.NumTris() ; t++ )
     {
-        tag = SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags );
-
-        fprintf( fp, "%d \n",  tag );
+        fprintf( fp, "%d \n",  m_ExportIndex.m_TagVec[t] );
     }
     return 0;
 }
@@ -1077,6 +987,16 @@ void MeshGeom::UpdateBBox()
     }
 }
 
+//==== Draw Type Implied By GUI Draw Settings ====//
+int MeshGeom::GetDrawType()
+{
+    if ( m_GuiDraw.GetDispSubSurfFlag() )
+    {
+        return MeshGeom::DRAW_TAGS;
+    }
+    return MeshGeom::DRAW_XYZ;
+}
+
 void MeshGeom::UpdateDrawObj()
 {
     // Add in SubSurfaces to TMeshVec if m_DrawSubSurfs is true
@@ -1084,15 +1004,8 @@ void MeshGeom::UpdateDrawObj()
 
     int num_uniq_tags = SubSurfaceMgr.GetNumTags();
 
-    // Update Draw type based on if the disp subsurface is true
-    if ( m_GuiDraw.GetDispSubSurfFlag() )
-    {
-        m_DrawType = MeshGeom::DRAW_TAGS;
-    }
-    else
-    {
-        m_DrawType = MeshGeom::DRAW_XYZ;
-    }
+    // Draw type follows the disp subsurface flag - kept local, draw objects may be built concurrently
+    int draw_type = GetDrawType();
 
     if ( m_DrawSubSurfs() )
     {
@@ -1102,16 +1015,16 @@ void MeshGeom::UpdateDrawObj()
     // Mesh Should Be Flat Before Calling this Method
     int add_ind = 0;
 
-    if ( m_DrawType() == MeshGeom::DRAW_XYZ || m_DrawType() == MeshGeom::DRAW_UV )
+    if ( draw_type == MeshGeom::DRAW_XYZ || draw_type == MeshGeom::DRAW_UV )
     {
         m_WireShadeDrawObj_vec.resize( m_TMeshVec.size(), DrawObj() );
     }
-    else if ( m_DrawType() == MeshGeom::DRAW_BOTH )
+    else if ( draw_type == MeshGeom::DRAW_BOTH )
     {
         m_WireShadeDrawObj_vec.resize( 2 * m_TMeshVec.size(), DrawObj() );
         add_ind = m_TMeshVec.size();
     }
-    else if ( m_DrawType() == MeshGeom::DRAW_TAGS )
+    else if ( draw_type == MeshGeom::DRAW_TAGS )
     {
         m_WireShadeDrawObj_vec.resize( num_uniq_tags );
         DrawObj new_obj;
@@ -1132,7 +1045,7 @@ void MeshGeom::UpdateDrawObj()
 
     if ( m_ViewMeshFlag.Get() )
     {
-        if ( m_DrawType() & MeshGeom::DRAW_XYZ )
+        if ( draw_type & MeshGeom::DRAW_XYZ )
         {
             for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
             {
@@ -1155,7 +1068,7 @@ void MeshGeom::UpdateDrawObj()
             }
         }
 
-        if ( m_DrawType() & MeshGeom::DRAW_UV )
+        if ( draw_type & MeshGeom::DRAW_UV )
         {
             for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
             {
@@ -1180,7 +1093,7 @@ void MeshGeom::UpdateDrawObj()
             }
         }
 
-        if ( m_DrawType() == MeshGeom::DRAW_TAGS && ! m_DrawSubSurfs() )
+        if ( draw_type == MeshGeom::DRAW_TAGS && ! m_DrawSubSurfs() )
         {
             // make map from tag to wire draw obj
 
@@ -1277,7 +1190,7 @@ void MeshGeom::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
     Geom::LoadDrawObjs( draw_obj_vec );
     for ( int i = 0 ; i < ( int )m_WireShadeDrawObj_vec.size() ; i++ )
     {
-        if ( m_DrawType() == MeshGeom::DRAW_TAGS && m_GuiDraw.GetDispSubSurfFlag() )
+        if ( GetDrawType() == MeshGeom::DRAW_TAGS && m_GuiDraw.GetDispSubSurfFlag() )
         {
             // Color sequence -- go around color wheel ncstep times with slight
             // offset from ncgrp basic colors.
@@ -1367,27 +1280,24 @@ void MeshGeom::CreateGeomResults( Results* res )
         vector< vec3d > pvec;
         Matrix4d XFormMat = GetTotalTransMat();
         //==== Write Out Nodes ====//
-        for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+        for ( int i = 0 ; i < m_ExportIndex.NumPnts() ; i++ )
         {
-            TNode* tnode = m_IndexedNodeVec[i];
-            pvec.push_back( XFormMat.xform( tnode->m_Pnt ) );
+            pvec.push_back( XFormMat.xform( m_ExportIndex.m_PntVec[i] ) );
         }
-        res->Add( NameValData( "Num_Pnts", ( int )m_IndexedNodeVec.size() ) );
+        res->Add( NameValData( "Num_Pnts", m_ExportIndex.NumPnts() ) );
         res->Add( NameValData( "Tri_Pnts", pvec ) );
 
         //==== Write Out Tris ====//
         vector< int > id0_vec;
         vector< int > id1_vec;
         vector< int > id2_vec;
-        for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+        for ( int t = 0 ; t < m_ExportIndex.NumTris() ; t++ )
         {
-            TTri* ttri = m_IndexedTriVec[t];
-
-            id0_vec.push_back( ttri->m_N0->m_ID );
-            id1_vec.push_back( ttri->m_N1->m_ID );
-            id2_vec.push_back( ttri->m_N2->m_ID );
+            id0_vec.push_back( m_ExportIndex.GetTriNode( t, 0 ) );
+            id1_vec.push_back( m_ExportIndex.GetTriNode( t, 1 ) );
+            id2_vec.push_back( m_ExportIndex.GetTriNode( t, 2 ) );
         }
-        res->Add( NameValData( "Num_Tris", ( int )m_IndexedTriVec.size() ) );
+        res->Add( NameValData( "Num_Tris", m_ExportIndex.NumTris() ) );
         res->Add( NameValData( "Tri_Index0", id0_vec ) );
         res->Add( NameValData( "Tri_Index1", id1_vec ) );
         res->Add( NameValData( "Tri_Index2", id2_vec ) );
@@ -1421,8 +1331,7 @@ void MeshGeom::CreateGeomResults( Results* res )
 void MeshGeom::CreatePtCloudGeom()
 {
     BuildIndexedMesh( 0 );
-    vector < TNode* > nvec = m_IndexedNodeVec;
-    int npts = nvec.size();
+    int npts = m_ExportIndex.NumPnts();
 
     if ( npts > 0 )
     {
@@ -1444,7 +1353,7 @@ void MeshGeom::CreatePtCloudGeom()
 
             for ( int j = 0; j < npts; j++ )
             {
-                new_geom->m_Pts[j] = XFormMat.xform( nvec[j]->m_Pnt );
+                new_geom->m_Pts[j] = XFormMat.xform( m_ExportIndex.m_PntVec[j] );
             }
 
             new_geom->InitPts();
@@ -1581,6 +1490,205 @@ void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
     }
 }
 
+void MeshGeom::IntersectSplitTMeshVec()
+{
+    int i, j;
+
+    //==== Intersect All Mesh Geoms ====//
+    vector< pair< int, int > > mesh_pairs;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            mesh_pairs.push_back( pair< int, int >( i, j ) );
+        }
+    }
+
+    //==== Pairs Whose Meshes Are Unchanged Since The Last Call Replay Their Segments ====//
+    TMeshISectCache* cache = m_Vehicle ? m_Vehicle->GetCompGeomISectCachePtr() : NULL;
+    TMeshISectCache new_cache;
+
+    vector< unsigned long long > hash_vec( m_TMeshVec.size(), 0 );
+    vector< int > same_vec( m_TMeshVec.size(), 0 );
+    if ( cache )
+    {
+        #pragma omp parallel for schedule( dynamic )
+        for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+        {
+            vector< double > mesh_key;
+            m_TMeshVec[m]->ContentKey( mesh_key );
+            hash_vec[m] = TMesh::ContentHash( mesh_key );
+
+            //==== Hash Match Alone Could Be A Collision - Compare The Stored Content ====//
+            map< unsigned long long, vector< double > >::const_iterator kit = cache->m_MeshKeyMap.find( hash_vec[m] );
+            same_vec[m] = ( kit != cache->m_MeshKeyMap.end() && kit->second == mesh_key );
+
+            #pragma omp critical
+            {
+                new_cache.m_MeshKeyMap[ hash_vec[m] ].swap( mesh_key );
+            }
+        }
+    }
+
+    vector< TMeshPairISect* > cached_vec( mesh_pairs.size(), NULL );
+    vector< pair< unsigned long long, unsigned long long > > key_vec( mesh_pairs.size() );
+    vector< bool > need_index( m_TMeshVec.size(), false );
+    for ( i = 0 ; i < ( int )mesh_pairs.size() ; i++ )
+    {
+        key_vec[i] = make_pair( hash_vec[ mesh_pairs[i].first ], hash_vec[ mesh_pairs[i].second ] );
+        if ( cache )
+        {
+            map< pair< unsigned long long, unsigned long long >, TMeshPairISect >::iterator it = cache->m_PairMap.find( key_vec[i] );
+            if ( it != cache->m_PairMap.end() && same_vec[ mesh_pairs[i].first ] && same_vec[ mesh_pairs[i].second ] )
+            {
+                cached_vec[i] = &it->second;
+            }
+            else
+            {
+                need_index[ mesh_pairs[i].first ] = true;
+                need_index[ mesh_pairs[i].second ] = true;
+            }
+        }
+    }
+
+    //==== Buffer Edges Per Pair, Then Add In Serial Order So Splits Match ====//
+    vector< vector< TTriISectEdge > > isect_bufs( mesh_pairs.size() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int p = 0 ; p < ( int )mesh_pairs.size() ; p++ )
+    {
+        if ( !cached_vec[p] )
+        {
+            m_TMeshVec[ mesh_pairs[p].first ]->Intersect( m_TMeshVec[ mesh_pairs[p].second ], isect_bufs[p] );
+        }
+    }
+
+    //==== Tri Index Lookup For Meshes That Need New Cache Entries ====//
+    vector< vector< pair< TTri*, int > > > tri_ind_vec( m_TMeshVec.size() );
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        if ( need_index[i] )
+        {
+            vector< TTri* > & tvec = m_TMeshVec[i]->m_TVec;
+            tri_ind_vec[i].resize( tvec.size() );
+            for ( j = 0 ; j < ( int )tvec.size() ; j++ )
+            {
+                tri_ind_vec[i][j] = pair< TTri*, int >( tvec[j], j );
+            }
+            sort( tri_ind_vec[i].begin(), tri_ind_vec[i].end() );
+        }
+    }
+
+    for ( i = 0 ; i < ( int )mesh_pairs.size() ; i++ )
+    {
+        TMesh* tm0 = m_TMeshVec[ mesh_pairs[i].first ];
+        TMesh* tm1 = m_TMeshVec[ mesh_pairs[i].second ];
+
+        if ( cached_vec[i] )
+        {
+            const TMeshPairISect & pisect = *cached_vec[i];
+            for ( j = 0 ; j < ( int )pisect.m_TriIndVec.size() ; j++ )
+            {
+                int tind = pisect.m_TriIndVec[j];
+                TTri* tri = tind >= 0 ? tm0->m_TVec[ tind ] : tm1->m_TVec[ -1 - tind ];
+
+                TEdge* ie = new TEdge();
+                ie->m_N0 = new TNode();
+                ie->m_N0->m_Pnt = pisect.m_Pnt0Vec[j];
+                ie->m_N1 = new TNode();
+                ie->m_N1->m_Pnt = pisect.m_Pnt1Vec[j];
+                tri->m_ISectEdgeVec.push_back( ie );
+            }
+            new_cache.m_PairMap[ key_vec[i] ] = pisect;
+            continue;
+        }
+
+        TMeshPairISect* pisect = NULL;
+        if ( cache )
+        {
+            pisect = &new_cache.m_PairMap[ key_vec[i] ];
+            *pisect = TMeshPairISect();
+        }
+        for ( j = 0 ; j < ( int )isect_bufs[i].size() ; j++ )
+        {
+            TTri* tri = isect_bufs[i][j].first;
+            TEdge* ie = isect_bufs[i][j].second;
+            tri->m_ISectEdgeVec.push_back( ie );
+
+            if ( pisect )
+            {
+                const vector< pair< TTri*, int > > & lookup0 = tri_ind_vec[ mesh_pairs[i].first ];
+                const vector< pair< TTri*, int > > & lookup1 = tri_ind_vec[ mesh_pairs[i].second ];
+                vector< pair< TTri*, int > >::const_iterator it = lower_bound( lookup0.begin(), lookup0.end(), pair< TTri*, int >( tri, -1 ) );
+                if ( it != lookup0.end() && it->first == tri )
+                {
+                    pisect->m_TriIndVec.push_back( it->second );
+                }
+                else
+                {
+                    it = lower_bound( lookup1.begin(), lookup1.end(), pair< TTri*, int >( tri, -1 ) );
+                    pisect->m_TriIndVec.push_back( -1 - it->second );
+                }
+                pisect->m_Pnt0Vec.push_back( ie->m_N0->m_Pnt );
+                pisect->m_Pnt1Vec.push_back( ie->m_N1->m_Pnt );
+            }
+        }
+    }
+
+    //==== Keep Only The Pairs Of This Call So The Cache Stays Bounded ====//
+    if ( cache )
+    {
+        cache->m_MeshKeyMap.swap( new_cache.m_MeshKeyMap );
+        cache->m_PairMap.swap( new_cache.m_PairMap );
+    }
+
+    //==== Split Intersected Tri in Mesh - Meshes Share No Nodes ====//
+    #pragma omp parallel for schedule( dynamic )
+    for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+    {
+        m_TMeshVec[m]->Split();
+    }
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+    }
+}
+
+void MeshGeom::ComputeTrimTotals()
+{
+    //==== Compute Areas and Volumes Per Mesh ====//
+    vector< double > trimVolVec( m_TMeshVec.size(), 0.0 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+    {
+        if ( !m_TMeshVec[m]->m_HalfBoxFlag )
+        {
+            m_TMeshVec[m]->ComputeTheoArea();
+            m_TMeshVec[m]->ComputeWetArea();
+            m_TMeshVec[m]->ComputeTheoVol();
+            trimVolVec[m] = m_TMeshVec[m]->ComputeTrimVol();
+        }
+    }
+
+    //==== Sum In Mesh Order ====//
+    m_TotalTheoArea = m_TotalWetArea = 0.0;
+    m_TotalTheoVol = 0.0;
+    m_TotalWetVol = 0.0;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
+        {
+            m_TotalTheoArea += m_TMeshVec[i]->m_TheoArea;
+            m_TotalWetArea  += m_TMeshVec[i]->m_WetArea;
+            m_TotalTheoVol  += m_TMeshVec[i]->m_TheoVol;
+            m_TotalWetVol   += trimVolVec[i];
+        }
+    }
+}
+
 void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
 {
     int i, j;
@@ -1710,26 +1818,8 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
 
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    //==== Intersect, Split and Classify Tris ====//
+    IntersectSplitTMeshVec();
 
     if ( halfFlag )
     {
@@ -1755,36 +1845,8 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     ApplyScale();
     UpdateBBox();
 
-    //==== Compute Areas ====//
-    m_TotalTheoArea = m_TotalWetArea = 0.0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalTheoArea += m_TMeshVec[i]->ComputeTheoArea();
-            m_TotalWetArea  += m_TMeshVec[i]->ComputeWetArea();
-        }
-    }
-
-    //==== Compute Theo Vols ====//
-    m_TotalTheoVol = 0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalTheoVol += m_TMeshVec[i]->ComputeTheoVol();
-        }
-    }
-
-    //==== Compute Total Volume ====//
-    m_TotalWetVol = 0.0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalWetVol += m_TMeshVec[i]->ComputeTrimVol();
-        }
-    }
+    //==== Compute Areas and Volumes ====//
+    ComputeTrimTotals();
 
     double guessTotalWetVol = 0;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -1997,62 +2059,16 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
     m_BBox = b;
     //update_xformed_bbox();          // Load Xform BBox
 
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    //==== Intersect, Split and Classify Tris ====//
+    IntersectSplitTMeshVec();
 
     //===== Reset Scale =====//
     m_Scale = 1;
     ApplyScale();
     UpdateBBox();
 
-    //==== Compute Areas ====//
-    m_TotalTheoArea = m_TotalWetArea = 0.0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalTheoArea += m_TMeshVec[i]->ComputeTheoArea();
-            m_TotalWetArea  += m_TMeshVec[i]->ComputeWetArea();
-        }
-    }
-
-    //==== Compute Theo Vols ====//
-    m_TotalTheoVol = 0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalTheoVol += m_TMeshVec[i]->ComputeTheoVol();
-        }
-    }
-
-    //==== Compute Total Volume ====//
-    m_TotalWetVol = 0.0;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        if ( !m_TMeshVec[i]->m_HalfBoxFlag )
-        {
-            m_TotalWetVol += m_TMeshVec[i]->ComputeTrimVol();
-        }
-    }
+    //==== Compute Areas and Volumes ====//
+    ComputeTrimTotals();
 
     double guessTotalWetVol = 0;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2136,7 +2152,7 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
-                          bool autoBounds, double start, double end )
+                          bool autoBounds, double start, double end, bool directFlag )
 {
     int tesselate = 0;
     int i, j, s;
@@ -2269,116 +2285,140 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         xMax = end + 0.0001;
     }
 
-    //==== Build Slice Mesh Object =====//
-    // MJW: Mandating 3 slices is a preference. 2 is just fine, and sometimes necessary.
-    //if ( numSlices < 3 )
-    //{
-        //numSlices = 3;
-    //}
+    vector< double > loc_vec( numSlices );
+    for ( s = 0 ; s < numSlices ; s++ )
+    {
+        loc_vec[s] = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
+    }
 
-    vec3d norm( 1, 0, 0 );
+    vector< double > area_vec;
+    vector< vec3d > AreaCenter;
+    vector< int > contour_vec;
 
-    for ( s = 0 ; s < numSlices ; s++ )
+    if ( directFlag )
     {
-        TMesh* tm = new TMesh();
-        m_SliceVec.push_back( tm );
+        //==== Trim To The Outer Surface Once, Then Cut It Directly ====//
+        IntersectSplitTMeshVec();
 
-        double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
+        AreaSection( loc_vec, area_vec, AreaCenter, contour_vec );
+    }
+    else
+    {
+        //==== Build Slice Mesh Object =====//
+        // MJW: Mandating 3 slices is a preference. 2 is just fine, and sometimes necessary.
+        //if ( numSlices < 3 )
+        //{
+            //numSlices = 3;
+        //}
 
-        double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
-        double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
-        double zdel = 1.02 * ( m_BBox.GetMax( 2 ) - m_BBox.GetMin( 2 ) );
-        double zs   = m_BBox.GetMin( 2 ) - 0.01 * zdel;
+        vec3d norm( 1, 0, 0 );
 
-        if ( tesselate )
+        for ( s = 0 ; s < numSlices ; s++ )
         {
-            for ( i = 0 ; i < 10 ; i++ )
-            {
-                double y0 = ys + ydel * 0.1 * ( double )i;
-                double y1 = ys + ydel * 0.1 * ( double )( i + 1 );
+            TMesh* tm = new TMesh();
+            m_SliceVec.push_back( tm );
+
+            double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
 
-                for ( j = 0 ; j < 10 ; j++ )
+            double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
+            double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
+            double zdel = 1.02 * ( m_BBox.GetMax( 2 ) - m_BBox.GetMin( 2 ) );
+            double zs   = m_BBox.GetMin( 2 ) - 0.01 * zdel;
+
+            if ( tesselate )
+            {
+                for ( i = 0 ; i < 10 ; i++ )
                 {
-                    double z0 = zs + zdel * 0.1 * ( double )j;
-                    double z1 = zs + zdel * 0.1 * ( double )( j + 1 );
+                    double y0 = ys + ydel * 0.1 * ( double )i;
+                    double y1 = ys + ydel * 0.1 * ( double )( i + 1 );
 
-                    tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z0 ), vec3d( x, y1, z1 ), norm );
-                    tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z1 ), vec3d( x, y0, z1 ), norm );
+                    for ( j = 0 ; j < 10 ; j++ )
+                    {
+                        double z0 = zs + zdel * 0.1 * ( double )j;
+                        double z1 = zs + zdel * 0.1 * ( double )( j + 1 );
+
+                        tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z0 ), vec3d( x, y1, z1 ), norm );
+                        tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z1 ), vec3d( x, y0, z1 ), norm );
+                    }
                 }
             }
+            else
+            {
+                tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs ), vec3d( x, ys + ydel, zs + zdel ), norm );
+                tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs + zdel ), vec3d( x, ys, zs + zdel ), norm );
+            }
         }
-        else
-        {
-            tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs ), vec3d( x, ys + ydel, zs + zdel ), norm );
-            tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs + zdel ), vec3d( x, ys, zs + zdel ), norm );
-        }
-    }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        //==== Load Bnding Box ====//
+        for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
         {
-            tm->Intersect( m_TMeshVec[i] );
+            TMesh* tm = m_SliceVec[s];
+            tm->LoadBndBox();
 
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
+            //==== Intersect All Mesh Geoms ====//
+            for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
             {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+                tm->Intersect( m_TMeshVec[i] );
+
+                for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
                 {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
+                    TTri* tri = m_TMeshVec[i]->m_TVec[j];
+                    for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+                    {
+                        delete tri->m_ISectEdgeVec[e]->m_N0;
+                        delete tri->m_ISectEdgeVec[e]->m_N1;
+                        delete tri->m_ISectEdgeVec[e];
+                    }
+                    tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
                 }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
             }
-        }
 
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
+            //==== Split Intersected Tri in Mesh ====//
+            tm->Split();
 
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
+            //==== Determine Which Triangle Are Interior/Exterior ====//
+            tm->DeterIntExt( m_TMeshVec );
 
-        //==== Flip Int/Ext Flags ====//
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
+            //==== Flip Int/Ext Flags ====//
+            for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
             {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                TTri* tri = tm->m_TVec[i];
+                if ( tri->m_SplitVec.size() )
                 {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
+                    for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                    {
+                        tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
+                    }
+                }
+                else
+                {
+                    tri->m_InteriorFlag = !( tri->m_InteriorFlag );
                 }
             }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
+        }
+
+        for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+        {
+            m_SliceVec[s]->ComputeWetArea();
+            area_vec.push_back( m_SliceVec[s]->m_WetArea );
+            AreaCenter.push_back( m_SliceVec[s]->m_AreaCenter );
         }
     }
 
     TransMat.affineInverse();
 
-    vector< double > loc_vec;
-    vector< double > area_vec;
-    vector < vec3d > AreaCenter;
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    for ( s = 0 ; s < ( int )AreaCenter.size() ; s++ )
     {
-        double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
-        m_SliceVec[s]->ComputeWetArea();
-        loc_vec.push_back( x );
-        area_vec.push_back( m_SliceVec[s]->m_WetArea );
-        AreaCenter.push_back( TransMat.xform( m_SliceVec[s]->m_AreaCenter ) );
+        AreaCenter[s] = TransMat.xform( AreaCenter[s] );
     }
     res->Add( NameValData( "Slice_Area_Center", AreaCenter ) );
-    res->Add( NameValData( "Num_Slices", ( int )m_SliceVec.size() ) );
+    res->Add( NameValData( "Num_Slices", numSlices ) );
     res->Add( NameValData( "Slice_Loc", loc_vec ) );
     res->Add( NameValData( "Slice_Area", area_vec ) );
+    if ( directFlag )
+    {
+        res->Add( NameValData( "Slice_Num_Contours", contour_vec ) );
+    }
 
     string filename = m_Vehicle->getExportFileName( vsp::SLICE_TXT_TYPE );
     res->WriteSliceFile( filename );
@@ -2388,6 +2428,275 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
     TransformMeshVec( m_TMeshVec, TransMat );
 }
 
+//==== Lexicographic Order Used To Merge Coincident Section Nodes ====//
+static bool SectionPntLess( const vec3d & a, const vec3d & b )
+{
+    if ( a.x() != b.x() )
+    {
+        return a.x() < b.x();
+    }
+    if ( a.y() != b.y() )
+    {
+        return a.y() < b.y();
+    }
+    return a.z() < b.z();
+}
+
+struct SectionCornerLess
+{
+    const vector< vec3d > * m_PntVec;
+    bool operator()( int a, int b ) const
+    {
+        return SectionPntLess( ( *m_PntVec )[a], ( *m_PntVec )[b] );
+    }
+};
+
+//==== Plane Crossing Of Edge - Always Evaluated From The Below Node So Neighbors Agree Exactly ====//
+static vec3d SectionPnt( const vec3d & below, const vec3d & above, double x )
+{
+    double t = ( x - below.x() ) / ( above.x() - below.x() );
+    return below + ( above - below ) * t;
+}
+
+//==== Cut The Exterior Tris Of m_TMeshVec With Planes x = locVec[s] ====//
+// Each plane is cut directly against an indexed copy of the outer surface - no slice meshes, tri-tri
+// tests or ray casts.  Segments are oriented by the tri winding, so area and centroid follow from
+// Green's theorem and segments chain into contours through the mesh edges they cross.
+void MeshGeom::AreaSection( const vector< double > & locVec, vector< double > & areaVec,
+                            vector< vec3d > & centerVec, vector< int > & numContourVec )
+{
+    int nloc = ( int )locVec.size();
+    areaVec.assign( nloc, 0.0 );
+    centerVec.assign( nloc, vec3d() );
+    numContourVec.assign( nloc, 0 );
+
+    //==== Gather Exterior Tri Corners ====//
+    vector< vec3d > cornerVec;
+    for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+    {
+        TMesh* tm = m_TMeshVec[m];
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            if ( tri->m_SplitVec.size() )
+            {
+                for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
+                {
+                    TTri* stri = tri->m_SplitVec[k];
+                    if ( !stri->m_InteriorFlag )
+                    {
+                        cornerVec.push_back( stri->m_N0->m_Pnt );
+                        cornerVec.push_back( stri->m_N1->m_Pnt );
+                        cornerVec.push_back( stri->m_N2->m_Pnt );
+                    }
+                }
+            }
+            else if ( !tri->m_InteriorFlag )
+            {
+                cornerVec.push_back( tri->m_N0->m_Pnt );
+                cornerVec.push_back( tri->m_N1->m_Pnt );
+                cornerVec.push_back( tri->m_N2->m_Pnt );
+            }
+        }
+    }
+
+    //==== Index Coincident Corners So Neighboring Tris Share Edges ====//
+    int ncorner = ( int )cornerVec.size();
+    int ntri = ncorner / 3;
+
+    vector< int > orderVec( ncorner );
+    for ( int i = 0 ; i < ncorner ; i++ )
+    {
+        orderVec[i] = i;
+    }
+    SectionCornerLess cornerLess;
+    cornerLess.m_PntVec = &cornerVec;
+    sort( orderVec.begin(), orderVec.end(), cornerLess );
+
+    vector< vec3d > pntVec;
+    vector< int > triNodeVec( ncorner );
+    for ( int i = 0 ; i < ncorner ; i++ )
+    {
+        const vec3d & p = cornerVec[ orderVec[i] ];
+        if ( pntVec.empty() || SectionPntLess( pntVec.back(), p ) )
+        {
+            pntVec.push_back( p );
+        }
+        triNodeVec[ orderVec[i] ] = ( int )pntVec.size() - 1;
+    }
+
+    //==== Planes May Come In Any Order - Bucket Against Them Sorted ====//
+    vector< pair< double, int > > locOrderVec( nloc );
+    for ( int s = 0 ; s < nloc ; s++ )
+    {
+        locOrderVec[s] = pair< double, int >( locVec[s], s );
+    }
+    sort( locOrderVec.begin(), locOrderVec.end() );
+
+    vector< double > sortLocVec( nloc );
+    for ( int s = 0 ; s < nloc ; s++ )
+    {
+        sortLocVec[s] = locOrderVec[s].first;
+    }
+
+    //==== One Pass Over The Tris - Each Lands In The Buckets Of The Planes Its X Extent Spans ====//
+    vector< int > firstVec( nloc + 1, 0 );
+    vector< pair< int, int > > spanVec( ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        double x0 = pntVec[ triNodeVec[3 * t] ].x();
+        double x1 = pntVec[ triNodeVec[3 * t + 1] ].x();
+        double x2 = pntVec[ triNodeVec[3 * t + 2] ].x();
+        double xlo = min( x0, min( x1, x2 ) );
+        double xhi = max( x0, max( x1, x2 ) );
+
+        int slo = ( int )( lower_bound( sortLocVec.begin(), sortLocVec.end(), xlo ) - sortLocVec.begin() );
+        int shi = ( int )( upper_bound( sortLocVec.begin(), sortLocVec.end(), xhi ) - sortLocVec.begin() );
+        spanVec[t] = pair< int, int >( slo, shi );
+
+        for ( int s = slo ; s < shi ; s++ )
+        {
+            firstVec[s + 1]++;
+        }
+    }
+    for ( int s = 0 ; s < nloc ; s++ )
+    {
+        firstVec[s + 1] += firstVec[s];
+    }
+
+    vector< int > bucketVec( firstVec[nloc] );
+    vector< int > fillVec( firstVec.begin(), firstVec.end() - 1 );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        for ( int s = spanVec[t].first ; s < spanVec[t].second ; s++ )
+        {
+            bucketVec[ fillVec[s]++ ] = t;
+        }
+    }
+
+    //==== Moments Taken About The Bounding Box Center To Limit Cancellation ====//
+    double yc = m_BBox.GetCenter().y();
+    double zc = m_BBox.GetCenter().z();
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int s = 0 ; s < nloc ; s++ )
+    {
+        double x = sortLocVec[s];
+
+        //==== Segment Runs From The Edge Crossed Going Down To The Edge Crossed Going Up ====//
+        // Edges are keyed ( below node, above node ), so a segment's end key is its neighbor's start key.
+        vector< pair< int, int > > startVec;
+        vector< pair< int, int > > endVec;
+
+        for ( int b = firstVec[s] ; b < firstVec[s + 1] ; b++ )
+        {
+            const int* n = &triNodeVec[ 3 * bucketVec[b] ];
+
+            //==== Nodes On The Plane Count As Above So Every Edge Crosses At Most Once ====//
+            bool above[3];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                above[k] = ( pntVec[ n[k] ].x() >= x );
+            }
+
+            int found = 0;
+            pair< int, int > down, up;
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                int k1 = ( k + 1 ) % 3;
+                if ( above[k] && !above[k1] )
+                {
+                    down = pair< int, int >( n[k1], n[k] );
+                    found++;
+                }
+                else if ( !above[k] && above[k1] )
+                {
+                    up = pair< int, int >( n[k], n[k1] );
+                    found++;
+                }
+            }
+
+            if ( found == 2 )
+            {
+                startVec.push_back( down );
+                endVec.push_back( up );
+            }
+        }
+
+        int nseg = ( int )startVec.size();
+
+        double area = 0.0;
+        double ymom = 0.0;
+        double zmom = 0.0;
+        for ( int g = 0 ; g < nseg ; g++ )
+        {
+            vec3d p0 = SectionPnt( pntVec[ startVec[g].first ], pntVec[ startVec[g].second ], x );
+            vec3d p1 = SectionPnt( pntVec[ endVec[g].first ], pntVec[ endVec[g].second ], x );
+
+            double y0 = p0.y() - yc;
+            double z0 = p0.z() - zc;
+            double y1 = p1.y() - yc;
+            double z1 = p1.z() - zc;
+
+            double c = y0 * z1 - y1 * z0;
+            area += c;
+            ymom += ( y0 + y1 ) * c;
+            zmom += ( z0 + z1 ) * c;
+        }
+        area *= 0.5;
+
+        //==== Chain Segments Into Contours - Open Chains From Their Heads First, Then Closed Loops ====//
+        map< pair< int, int >, int > startMap;
+        for ( int g = 0 ; g < nseg ; g++ )
+        {
+            startMap[ startVec[g] ] = g;
+        }
+
+        vector< int > nextVec( nseg, -1 );
+        vector< bool > headVec( nseg, true );
+        for ( int g = 0 ; g < nseg ; g++ )
+        {
+            map< pair< int, int >, int >::const_iterator it = startMap.find( endVec[g] );
+            if ( it != startMap.end() )
+            {
+                nextVec[g] = it->second;
+                headVec[ it->second ] = false;
+            }
+        }
+
+        int ncontour = 0;
+        vector< bool > usedVec( nseg, false );
+        for ( int pass = 0 ; pass < 2 ; pass++ )
+        {
+            for ( int g = 0 ; g < nseg ; g++ )
+            {
+                if ( usedVec[g] || ( pass == 0 && !headVec[g] ) )
+                {
+                    continue;
+                }
+
+                ncontour++;
+                for ( int curr = g ; curr >= 0 && !usedVec[curr] ; curr = nextVec[curr] )
+                {
+                    usedVec[curr] = true;
+                }
+            }
+        }
+
+        int ind = locOrderVec[s].second;
+        areaVec[ind] = area;
+        numContourVec[ind] = ncontour;
+        if ( area != 0.0 )
+        {
+            centerVec[ind] = vec3d( x, yc + ymom / ( 6.0 * area ), zc + zmom / ( 6.0 * area ) );
+        }
+        else
+        {
+            centerVec[ind] = vec3d( x, yc, zc );
+        }
+    }
+}
+
 void MeshGeom::WaveStartEnd( const double &sliceAngle, const vec3d &center )
 {
     int ntheta = WaveDragMgr.m_NTheta;
@@ -2828,52 +3137,13 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
     }
 
-    //==== Load Bnding Box ====//
-    for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
-    {
-        TMesh* tm = m_SliceVec[islice];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( int j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangles Are Interior/Exterior ====//
-        tm->WaveDeterIntExt( m_TMeshVec );
+    //==== Every Theta And Slice Is Independent - Vehicle Boxes Above Are Shared Read-Only ====//
+    int nslicemesh = ( int )m_SliceVec.size();
 
-        //==== Flip Int/Ext Flags ====//
-        for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( int j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
-                }
-            }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
-        }
+    #pragma omp parallel for schedule( dynamic )
+    for ( int islice = 0 ; islice < nslicemesh ; islice++ )
+    {
+        WaveSliceIntExt( m_SliceVec[islice] );
     }
 
     //==== Pushback slice and area results ====//
@@ -2893,6 +3163,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     WaveDragMgr.m_ExitArea = exA;
 
 
+    #pragma omp parallel for schedule( dynamic )
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
         for ( int itheta = 0; itheta < coneSections; itheta++ )
@@ -3085,198 +3356,103 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         }
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Slice, Classify and Integrate Each Slab Independently ====//
+    int nmesh = ( int )m_TMeshVec.size();
+    map< string, int > compIndMap;
+    for ( i = 0 ; i < nmesh ; i++ )
     {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
+        compIndMap[ m_TMeshVec[i]->m_PtrID ] = i;
+    }
 
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
+    //==== Last Entry Collects Tris Not Matched To A Component ====//
+    vec3d ref = m_BBox.GetCenter();
+    int nslice = ( int )m_SliceVec.size();
+    vector< vector< MassPropSum > > slabSumVec( nslice, vector< MassPropSum >( nmesh + 1, MassPropSum( ref ) ) );
+    vector< double > slabMinDen( nslice, 1.0e06 );
+    vector< double > slabMaxDen( nslice, 0.0 );
 
-    }
-    /**********
-        //==== Delete Mesh Geometry ====//
-        for ( i = 0 ; i < (int)tMeshVec.size() ; i++ )
-        {
-            delete tMeshVec[i];
-        }
-        tMeshVec.erase( tMeshVec.begin(), tMeshVec.end() );
-    *********/
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    #pragma omp parallel for schedule( dynamic )
+    for ( int ss = 0 ; ss < nslice ; ss++ )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
+        MassSliceSlab( m_SliceVec[ss], sliceW, false, compIndMap, slabSumVec[ss], slabMinDen[ss], slabMaxDen[ss] );
     }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    //==== Reduce Slabs In Order So Results Do Not Depend On Thread Count ====//
+    vector< MassPropSum > solidSumVec( nmesh + 1, MassPropSum( ref ) );
+    m_MinTriDen = 1.0e06;
+    m_MaxTriDen = 0.0;
+    for ( s = 0 ; s < nslice ; s++ )
     {
-        m_TMeshVec[i]->Split();
+        for ( i = 0 ; i <= nmesh ; i++ )
+        {
+            solidSumVec[i].Add( slabSumVec[s][i] );
+        }
+        m_MinTriDen = min( m_MinTriDen, slabMinDen[s] );
+        m_MaxTriDen = max( m_MaxTriDen, slabMaxDen[s] );
     }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    //==== Intersect, Split and Classify Tris ====//
+    IntersectSplitTMeshVec();
 
     //==== Do Shell Calcs ====//
-    vector< TriShellMassProp* > triShellVec;
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    vector< MassPropSum > shellSumVec( nmesh, MassPropSum( ref ) );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int m = 0 ; m < nmesh ; m++ )
     {
-        TMesh* tm = m_TMeshVec[s];
+        TMesh* tm = m_TMeshVec[m];
         if ( tm->m_ShellFlag )
         {
-            for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+            for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
             {
-                TTri* tri = tm->m_TVec[i];
+                TTri* tri = tm->m_TVec[t];
                 if ( tri->m_SplitVec.size() )
                 {
-                    for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                    for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
                     {
-                        if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                        if ( tri->m_SplitVec[k]->m_InteriorFlag == 0 )
                         {
-                            TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                                    tri->m_SplitVec[j]->m_N0->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N1->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N2->m_Pnt );
-                            triShellVec.push_back( tsmp );
+                            TriShellMassProp tsmp( tm->m_PtrID, tm->m_ShellMassArea,
+                                                   tri->m_SplitVec[k]->m_N0->m_Pnt,
+                                                   tri->m_SplitVec[k]->m_N1->m_Pnt,
+                                                   tri->m_SplitVec[k]->m_N2->m_Pnt );
+                            shellSumVec[m].Add( tsmp.m_Mass, 0.0, tsmp.m_CG, tsmp.m_Ixx, tsmp.m_Iyy, tsmp.m_Izz,
+                                                tsmp.m_Ixy, tsmp.m_Ixz, tsmp.m_Iyz );
                         }
                     }
                 }
                 else if ( tri->m_InteriorFlag == 0 )
                 {
-                    TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                            tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
-                    triShellVec.push_back( tsmp );
-                }
-            }
-        }
-    }
-
-    //==== Build Tetrahedrons ====//
-    double prismLength = sliceW;
-    vector< TetraMassProp* > tetraVec;
-    m_MinTriDen = 1.0e06;
-    m_MaxTriDen = 0.0;
-
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
-                    {
-                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
-                    }
+                    TriShellMassProp tsmp( tm->m_PtrID, tm->m_ShellMassArea,
+                                           tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
+                    shellSumVec[m].Add( tsmp.m_Mass, 0.0, tsmp.m_CG, tsmp.m_Ixx, tsmp.m_Iyy, tsmp.m_Izz,
+                                        tsmp.m_Ixy, tsmp.m_Ixz, tsmp.m_Iyz );
                 }
             }
-            else if ( tri->m_InteriorFlag == 0 )
-            {
-                CreatePrism( tetraVec, tri, prismLength );
-            }
         }
     }
 
-    //==== Add in Point Masses ====//
-    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
-    {
-        tetraVec.push_back( m_PointMassVec[i] );
-    }
-
-    double totalVol = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        totalVol += std::abs( tetraVec[i]->m_Vol );
-    }
-
-    vec3d cg( 0, 0, 0 );
-    m_TotalMass = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
+    //==== Totals - Solids, Shells and Point Masses ====//
+    MassPropSum totalSum( ref );
+    for ( i = 0 ; i <= nmesh ; i++ )
     {
-        m_TotalMass += tetraVec[i]->m_Mass;
-        cg = cg + tetraVec[i]->m_CG * tetraVec[i]->m_Mass;
+        totalSum.Add( solidSumVec[i] );
     }
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
+    for ( i = 0 ; i < nmesh ; i++ )
     {
-        m_TotalMass += triShellVec[i]->m_Mass;
-        cg = cg + triShellVec[i]->m_CG * triShellVec[i]->m_Mass;
+        totalSum.Add( shellSumVec[i] );
     }
-
-    if ( m_TotalMass )
+    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
-        cg = cg * ( 1.0 / m_TotalMass );
+        TetraMassProp* pm = m_PointMassVec[i];
+        totalSum.Add( pm->m_Mass, std::abs( pm->m_Vol ), pm->m_CG, pm->m_Ixx, pm->m_Iyy, pm->m_Izz,
+                      pm->m_Ixy, pm->m_Ixz, pm->m_Iyz );
     }
 
-    m_CenterOfGrav = cg;
-
-    m_TotalIxx = m_TotalIyy = m_TotalIzz = 0.0;
-    m_TotalIxy = m_TotalIxz = m_TotalIyz = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        TetraMassProp* tet = tetraVec[i];
-        m_TotalIxx += tet->m_Ixx +
-                      tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIyy += tet->m_Iyy +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIzz += tet->m_Izz +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) );
-
-        m_TotalIxy += tet->m_Ixy +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.y() - tet->m_CG.y() ) );
-        m_TotalIxz += tet->m_Ixz +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIyz += tet->m_Iyz +
-                      tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.z() - tet->m_CG.z() ) );
-    }
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-    {
-        TriShellMassProp* trs = triShellVec[i];
-        m_TotalIxx += trs->m_Ixx +
-                      trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIyy += trs->m_Iyy +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIzz += trs->m_Izz +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) );
-
-        m_TotalIxy += trs->m_Ixy +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.y() - trs->m_CG.y() ) );
-        m_TotalIxz += trs->m_Ixz +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIyz += trs->m_Iyz +
-                      trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.z() - trs->m_CG.z() ) );
-    }
+    double totalVol = totalSum.GetVol();
+    m_TotalMass = totalSum.GetWeight();
+    m_CenterOfGrav = totalSum.GetCG();
+    totalSum.GetInertia( m_TotalIxx, m_TotalIyy, m_TotalIzz, m_TotalIxy, m_TotalIxz, m_TotalIyz );
 
     vector< string > name_vec;
     vector< string > id_vec;
@@ -3290,103 +3466,28 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     vector< double > iyz_vec;
     vector< double > vol_vec;
 
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    for ( s = 0 ; s < nmesh ; s++ )
     {
         TMesh* tm = m_TMeshVec[s];
-        string id = tm->m_PtrID;
-        id_vec.push_back( id );
+        id_vec.push_back( tm->m_PtrID );
 
-        double compVol = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            if ( !tetraVec[i]->m_CompId.compare( id ) )
-            {
-                compVol += std::abs( tetraVec[i]->m_Vol );
-            }
-        }
+        MassPropSum compSum = solidSumVec[s];
+        compSum.Add( shellSumVec[s] );
 
-        cg = vec3d( 0, 0, 0 );
-        double compMass = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            if ( !tetraVec[i]->m_CompId.compare( id ) )
-            {
-                compMass += tetraVec[i]->m_Mass;
-                cg = cg + tetraVec[i]->m_CG * tetraVec[i]->m_Mass;
-            }
-        }
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            if ( !triShellVec[i]->m_CompId.compare( id ) )
-            {
-                compMass += triShellVec[i]->m_Mass;
-                cg = cg + triShellVec[i]->m_CG * triShellVec[i]->m_Mass;
-            }
-        }
-
-        if ( compMass )
-        {
-            cg = cg * ( 1.0 / compMass );
-        }
-
-        double compIxx = 0.0;
-        double compIyy = 0.0;
-        double compIzz = 0.0;
-        double compIxy = 0.0;
-        double compIxz = 0.0;
-        double compIyz = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            TetraMassProp* tet = tetraVec[i];
-            if ( !tet->m_CompId.compare( id ) )
-            {
-                compIxx += tet->m_Ixx +
-                           tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIyy += tet->m_Iyy +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIzz += tet->m_Izz +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) );
-
-                compIxy += tet->m_Ixy +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.y() - tet->m_CG.y() ) );
-                compIxz += tet->m_Ixz +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIyz += tet->m_Iyz +
-                           tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.z() - tet->m_CG.z() ) );
-            }
-        }
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            TriShellMassProp* trs = triShellVec[i];
-            if ( !trs->m_CompId.compare( id ) )
-            {
-                compIxx += trs->m_Ixx +
-                           trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIyy += trs->m_Iyy +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIzz += trs->m_Izz +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) );
-
-                compIxy += trs->m_Ixy +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.y() - trs->m_CG.y() ) );
-                compIxz += trs->m_Ixz +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIyz += trs->m_Iyz +
-                           trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.z() - trs->m_CG.z() ) );
-            }
-        }
+        double compIxx, compIyy, compIzz, compIxy, compIxz, compIyz;
+        compSum.GetInertia( compIxx, compIyy, compIzz, compIxy, compIxz, compIyz );
 
         //==== Load Component Results ====//
         name_vec.push_back( tm->m_NameStr );
-        mass_vec.push_back( compMass );
-        cg_vec.push_back( cg );
+        mass_vec.push_back( compSum.GetWeight() );
+        cg_vec.push_back( compSum.GetCG() );
         ixx_vec.push_back( compIxx );
         iyy_vec.push_back( compIyy );
         izz_vec.push_back( compIzz );
         ixy_vec.push_back( compIxy );
         ixz_vec.push_back( compIxz );
         iyz_vec.push_back( compIyz );
-        vol_vec.push_back( compVol );
+        vol_vec.push_back( solidSumVec[s].GetVol() );
     }
 
     res->Add( NameValData( "Num_Comps", ( int )name_vec.size() ) );
@@ -3414,15 +3515,11 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     res->Add( NameValData( "Total_Volume", totalVol ) );
 
     //==== Clean Up Mess ====//
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        delete tetraVec[i];
-    }
-
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
+    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
-        delete triShellVec[i];
+        delete m_PointMassVec[i];
     }
+    m_PointMassVec.clear();
 
     //==== Get Rid of TMeshes  that are not shells ====//
     vector<TMesh*> newTMeshVec;
@@ -3512,114 +3609,73 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         }
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Slice, Classify and Integrate Each Slab Independently ====//
+    int nmesh = ( int )m_TMeshVec.size();
+    map< string, int > compIndMap;
+    for ( i = 0 ; i < nmesh ; i++ )
     {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
+        compIndMap[ m_TMeshVec[i]->m_PtrID ] = i;
     }
 
+    //==== Last Entry Collects Tris Not Matched To A Component ====//
+    vec3d ref = m_BBox.GetCenter();
+    int nslice = ( int )m_SliceVec.size();
+    vector< vector< MassPropSum > > slabSumVec( nslice, vector< MassPropSum >( nmesh + 1, MassPropSum( ref ) ) );
+    vector< double > slabMinDen( nslice, 1.0e06 );
+    vector< double > slabMaxDen( nslice, 0.0 );
 
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    #pragma omp parallel for schedule( dynamic )
+    for ( int ss = 0 ; ss < nslice ; ss++ )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
+        MassSliceSlab( m_SliceVec[ss], sliceW, true, compIndMap, slabSumVec[ss], slabMinDen[ss], slabMaxDen[ss] );
     }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
-
-    //==== Do Shell Calcs ====//
-    vector< DegenGeomTriShellMassProp* > triShellVec;
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    //==== Reduce Slabs In Order So Results Do Not Depend On Thread Count ====//
+    vector< MassPropSum > solidSumVec( nmesh + 1, MassPropSum( ref ) );
+    m_MinTriDen = 1.0e06;
+    m_MaxTriDen = 0.0;
+    for ( s = 0 ; s < nslice ; s++ )
     {
-        TMesh* tm = m_TMeshVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        for ( i = 0 ; i <= nmesh ; i++ )
         {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
-                    {
-                        DegenGeomTriShellMassProp* tsmp = new DegenGeomTriShellMassProp( tm->m_PtrID, tri->m_SplitVec[j]->m_N0->m_Pnt,
-                                tri->m_SplitVec[j]->m_N1->m_Pnt,
-                                tri->m_SplitVec[j]->m_N2->m_Pnt );
-                        triShellVec.push_back( tsmp );
-                    }
-                }
-            }
-            else if ( tri->m_InteriorFlag == 0 )
-            {
-                DegenGeomTriShellMassProp* tsmp = new DegenGeomTriShellMassProp( tm->m_PtrID, tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
-                triShellVec.push_back( tsmp );
-            }
+            solidSumVec[i].Add( slabSumVec[s][i] );
         }
+        m_MinTriDen = min( m_MinTriDen, slabMinDen[s] );
+        m_MaxTriDen = max( m_MaxTriDen, slabMaxDen[s] );
     }
 
-    //==== Build Tetrahedrons ====//
-    double prismLength = sliceW;
-    vector< DegenGeomTetraMassProp* > tetraVec;
-    m_MinTriDen = 1.0e06;
-    m_MaxTriDen = 0.0;
+    //==== Intersect, Split and Classify Tris ====//
+    IntersectSplitTMeshVec();
 
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Do Shell Calcs ====//
+    vector< MassPropSum > shellSumVec( nmesh, MassPropSum( ref ) );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int m = 0 ; m < nmesh ; m++ )
     {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        TMesh* tm = m_TMeshVec[m];
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
         {
-            TTri* tri = tm->m_TVec[i];
-
+            TTri* tri = tm->m_TVec[t];
             if ( tri->m_SplitVec.size() )
             {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
                 {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                    if ( tri->m_SplitVec[k]->m_InteriorFlag == 0 )
                     {
-                        createDegenGeomPrism( tetraVec, tri->m_SplitVec[j], prismLength );
+                        DegenGeomTriShellMassProp tsmp( tm->m_PtrID, tri->m_SplitVec[k]->m_N0->m_Pnt,
+                                                        tri->m_SplitVec[k]->m_N1->m_Pnt,
+                                                        tri->m_SplitVec[k]->m_N2->m_Pnt );
+                        shellSumVec[m].Add( tsmp.m_TriArea, 0.0, tsmp.m_CG, tsmp.m_Ixx, tsmp.m_Iyy, tsmp.m_Izz,
+                                            tsmp.m_Ixy, tsmp.m_Ixz, tsmp.m_Iyz );
                     }
                 }
             }
             else if ( tri->m_InteriorFlag == 0 )
             {
-                createDegenGeomPrism( tetraVec, tri, prismLength );
+                DegenGeomTriShellMassProp tsmp( tm->m_PtrID, tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
+                shellSumVec[m].Add( tsmp.m_TriArea, 0.0, tsmp.m_CG, tsmp.m_Ixx, tsmp.m_Iyy, tsmp.m_Izz,
+                                    tsmp.m_Ixy, tsmp.m_Ixz, tsmp.m_Iyz );
             }
         }
     }
@@ -3629,115 +3685,18 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
     vector<vec3d> compSolidCg, compShellCg;
     vector< vector<double> > compSolidI, compShellI;
 
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    for ( s = 0 ; s < nmesh ; s++ )
     {
-        TMesh* tm = m_TMeshVec[s];
-        string id = tm->m_PtrID;
-
-        vec3d cgSolid( 0, 0, 0 ), cgShell( 0, 0, 0 );
-        double compMassSolid = 0.0, compMassShell = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            if ( !tetraVec[i]->m_CompId.compare( id ) )
-            {
-                compMassSolid += tetraVec[i]->m_Vol;
-                cgSolid = cgSolid + tetraVec[i]->m_CG * tetraVec[i]->m_Vol;
-            }
-        }
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            if ( !triShellVec[i]->m_CompId.compare( id ) )
-            {
-                compMassShell += triShellVec[i]->m_TriArea;
-                cgShell = cgShell + triShellVec[i]->m_CG * triShellVec[i]->m_TriArea;
-            }
-        }
-
-        if ( compMassSolid )
-        {
-            cgSolid = cgSolid * ( 1.0 / compMassSolid );
-        }
-        if ( compMassShell )
-        {
-            cgShell = cgShell * ( 1.0 / compMassShell );
-        }
-
-        compSolidCg.push_back( cgSolid );
-        compShellCg.push_back( cgShell );
-
-        double compIxx = 0.0;
-        double compIyy = 0.0;
-        double compIzz = 0.0;
-        double compIxy = 0.0;
-        double compIxz = 0.0;
-        double compIyz = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            DegenGeomTetraMassProp* tet = tetraVec[i];
-            if ( !tet->m_CompId.compare( id ) )
-            {
-                compIxx += tet->m_Ixx +
-                           tet->m_Vol * ( ( cgSolid.y() - tet->m_CG.y() ) * ( cgSolid.y() - tet->m_CG.y() ) + ( cgSolid.z() - tet->m_CG.z() ) * ( cgSolid.z() - tet->m_CG.z() ) );
-                compIyy += tet->m_Iyy +
-                           tet->m_Vol * ( ( cgSolid.x() - tet->m_CG.x() ) * ( cgSolid.x() - tet->m_CG.x() ) + ( cgSolid.z() - tet->m_CG.z() ) * ( cgSolid.z() - tet->m_CG.z() ) );
-                compIzz += tet->m_Izz +
-                           tet->m_Vol * ( ( cgSolid.x() - tet->m_CG.x() ) * ( cgSolid.x() - tet->m_CG.x() ) + ( cgSolid.y() - tet->m_CG.y() ) * ( cgSolid.y() - tet->m_CG.y() ) );
-
-                compIxy += tet->m_Ixy +
-                           tet->m_Vol * ( ( cgSolid.x() - tet->m_CG.x() ) * ( cgSolid.y() - tet->m_CG.y() ) );
-                compIxz += tet->m_Ixz +
-                           tet->m_Vol * ( ( cgSolid.x() - tet->m_CG.x() ) * ( cgSolid.z() - tet->m_CG.z() ) );
-                compIyz += tet->m_Iyz +
-                           tet->m_Vol * ( ( cgSolid.y() - tet->m_CG.y() ) * ( cgSolid.z() - tet->m_CG.z() ) );
-            }
-        }
-        vector<double> tempSolidI;
-        tempSolidI.push_back( compIxx );
-        tempSolidI.push_back( compIyy );
-        tempSolidI.push_back( compIzz );
-        tempSolidI.push_back( compIxy );
-        tempSolidI.push_back( compIxz );
-        tempSolidI.push_back( compIyz );
+        compSolidCg.push_back( solidSumVec[s].GetCG() );
+        compShellCg.push_back( shellSumVec[s].GetCG() );
 
+        vector<double> tempSolidI( 6 );
+        solidSumVec[s].GetInertia( tempSolidI[0], tempSolidI[1], tempSolidI[2], tempSolidI[3], tempSolidI[4], tempSolidI[5] );
         compSolidI.push_back( tempSolidI );
 
-        compIxx = 0.0;
-        compIyy = 0.0;
-        compIzz = 0.0;
-        compIxy = 0.0;
-        compIxz = 0.0;
-        compIyz = 0.0;
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            DegenGeomTriShellMassProp* trs = triShellVec[i];
-            if ( !trs->m_CompId.compare( id ) )
-            {
-                compIxx += trs->m_Ixx +
-                           trs->m_TriArea * ( ( cgShell.y() - trs->m_CG.y() ) * ( cgShell.y() - trs->m_CG.y() ) + ( cgShell.z() - trs->m_CG.z() ) * ( cgShell.z() - trs->m_CG.z() ) );
-                compIyy += trs->m_Iyy +
-                           trs->m_TriArea * ( ( cgShell.x() - trs->m_CG.x() ) * ( cgShell.x() - trs->m_CG.x() ) + ( cgShell.z() - trs->m_CG.z() ) * ( cgShell.z() - trs->m_CG.z() ) );
-                compIzz += trs->m_Izz +
-                           trs->m_TriArea * ( ( cgShell.x() - trs->m_CG.x() ) * ( cgShell.x() - trs->m_CG.x() ) + ( cgShell.y() - trs->m_CG.y() ) * ( cgShell.y() - trs->m_CG.y() ) );
-
-                compIxy += trs->m_Ixy +
-                           trs->m_TriArea * ( ( cgShell.x() - trs->m_CG.x() ) * ( cgShell.y() - trs->m_CG.y() ) );
-                compIxz += trs->m_Ixz +
-                           trs->m_TriArea * ( ( cgShell.x() - trs->m_CG.x() ) * ( cgShell.z() - trs->m_CG.z() ) );
-                compIyz += trs->m_Iyz +
-                           trs->m_TriArea * ( ( cgShell.y() - trs->m_CG.y() ) * ( cgShell.z() - trs->m_CG.z() ) );
-            }
-        }
-
-        vector<double> tempShellI;
-        tempShellI.push_back( compIxx );
-        tempShellI.push_back( compIyy );
-        tempShellI.push_back( compIzz );
-        tempShellI.push_back( compIxy );
-        tempShellI.push_back( compIxz );
-        tempShellI.push_back( compIyz );
-
+        vector<double> tempShellI( 6 );
+        shellSumVec[s].GetInertia( tempShellI[0], tempShellI[1], tempShellI[2], tempShellI[3], tempShellI[4], tempShellI[5] );
         compShellI.push_back( tempShellI );
-
     }
 
     bool matchFlag;
@@ -3778,32 +3737,106 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 
         degenGeom[i].setDegenPoint( degenPoint );
     }
+}
 
-    //==== Clean Up Mess ====//
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        delete tetraVec[i];
-    }
+//==== Intersect And Split A Slice Mesh - Safe To Run Concurrently Over Slices ====//
+void MeshGeom::IntersectSliceMesh( TMesh* tm )
+{
+    tm->LoadBndBox();
 
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
+    //==== Intersect All Mesh Geoms ====//
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        delete triShellVec[i];
+        vector< TTriISectEdge > isect_buf;
+        tm->Intersect( m_TMeshVec[i], isect_buf );
+
+        //==== Edges Come In Pairs, Slice Tri First - Shared Mesh Tris Are Never Touched ====//
+        for ( int e = 0 ; e < ( int )isect_buf.size() ; e++ )
+        {
+            TEdge* edge = isect_buf[e].second;
+            if ( e % 2 == 0 )
+            {
+                isect_buf[e].first->m_ISectEdgeVec.push_back( edge );
+            }
+            else
+            {
+                delete edge->m_N0;
+                delete edge->m_N1;
+                delete edge;
+            }
+        }
     }
 
+    //==== Split Intersected Tri in Mesh ====//
+    tm->Split();
 }
 
-//==== Create a Prism Made of Tetras - Extrude Tri +- len/2 ====//
-void MeshGeom::CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len )
+//==== Wave Drag Slices Keep The Area Enclosed By The Vehicle ====//
+void MeshGeom::WaveSliceIntExt( TMesh* tm )
 {
-    if ( tri->m_Mass < m_MinTriDen )
+    IntersectSliceMesh( tm );
+
+    //==== Determine Which Triangles Are Interior/Exterior ====//
+    tm->WaveDeterIntExt( m_TMeshVec );
+
+    //==== Flip Int/Ext Flags ====//
+    for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
     {
-        m_MinTriDen = tri->m_Mass;
+        TTri* tri = tm->m_TVec[i];
+        if ( tri->m_SplitVec.size() )
+        {
+            for ( int j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+            {
+                tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
+            }
+        }
+        else
+        {
+            tri->m_InteriorFlag = !( tri->m_InteriorFlag );
+        }
     }
-    if ( tri->m_Mass > m_MaxTriDen )
+}
+
+//==== Slice One X Slab Against All Meshes and Integrate Its Interior Prisms ====//
+void MeshGeom::MassSliceSlab( TMesh* tm, double len, bool degenFlag, const map< string, int > & compIndMap,
+                              vector< MassPropSum > & sumVec, double & minDen, double & maxDen )
+{
+    IntersectSliceMesh( tm );
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    tm->MassDeterIntExt( m_TMeshVec );
+
+    //==== Build Tetrahedrons ====//
+    vector< TTri* > triVec;
+    vector< vec3d > origVec;
+    tm->LoadIntExtQueries( triVec, origVec );
+
+    for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
     {
-        m_MaxTriDen = tri->m_Mass;
+        TTri* tri = triVec[t];
+        if ( tri->m_InteriorFlag == 0 )
+        {
+            minDen = min( minDen, tri->m_Mass );
+            maxDen = max( maxDen, tri->m_Mass );
+
+            map< string, int >::const_iterator it = compIndMap.find( tri->m_ID );
+            int ind = ( it != compIndMap.end() ) ? it->second : ( int )sumVec.size() - 1;
+
+            if ( degenFlag )
+            {
+                createDegenGeomPrism( sumVec[ind], tri, len );
+            }
+            else
+            {
+                CreatePrism( sumVec[ind], tri, len );
+            }
+        }
     }
+}
 
+//==== Create a Prism Made of Tetras - Extrude Tri +- len/2 ====//
+void MeshGeom::CreatePrism( MassPropSum & sum, TTri* tri, double len )
+{
     vec3d cnt = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) * ( 1.0 / 3.0 );
 
     vec3d p0 = tri->m_N0->m_Pnt;
@@ -3820,28 +3853,20 @@ void MeshGeom::CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, doubl
     p4.offset_x( -len / 2.0 );
     p5.offset_x( -len / 2.0 );
 
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p1, p2 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p4, p5 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p1, p3 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p4, p1 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p1, p2, p4 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p4, p5, p2 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p2, p3 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p5, p2 ) );
+    //==== Eight Tetras About The Centroid ====//
+    sum.AddTetra( tri->m_Mass, cnt, p0, p1, p2 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p4, p5 );
+    sum.AddTetra( tri->m_Mass, cnt, p0, p1, p3 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p4, p1 );
+    sum.AddTetra( tri->m_Mass, cnt, p1, p2, p4 );
+    sum.AddTetra( tri->m_Mass, cnt, p4, p5, p2 );
+    sum.AddTetra( tri->m_Mass, cnt, p0, p2, p3 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p5, p2 );
 }
 
 //==== Create a Prism Made of DegenGeomTetras - Extrude Tri +- len/2 ====//
-void MeshGeom::createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec, TTri* tri, double len )
+void MeshGeom::createDegenGeomPrism( MassPropSum & sum, TTri* tri, double len )
 {
-    if ( tri->m_Mass < m_MinTriDen )
-    {
-        m_MinTriDen = tri->m_Mass;
-    }
-    if ( tri->m_Mass > m_MaxTriDen )
-    {
-        m_MaxTriDen = tri->m_Mass;
-    }
-
     vec3d cnt = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) * ( 1.0 / 3.0 );
 
     vec3d p0 = tri->m_N0->m_Pnt;
@@ -3858,14 +3883,15 @@ void MeshGeom::createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec
     p4.offset_x( -len / 2.0 );
     p5.offset_x( -len / 2.0 );
 
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p0, p1, p2 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p3, p4, p5 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p0, p1, p3 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p3, p4, p1 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p1, p2, p4 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p4, p5, p2 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p0, p2, p3 ) );
-    tetraVec.push_back( new DegenGeomTetraMassProp( tri->m_ID, cnt, p3, p5, p2 ) );
+    //==== DegenGeom Properties Are Volume Weighted - Unit Density ====//
+    sum.AddTetra( 1.0, cnt, p0, p1, p2 );
+    sum.AddTetra( 1.0, cnt, p3, p4, p5 );
+    sum.AddTetra( 1.0, cnt, p0, p1, p3 );
+    sum.AddTetra( 1.0, cnt, p3, p4, p1 );
+    sum.AddTetra( 1.0, cnt, p1, p2, p4 );
+    sum.AddTetra( 1.0, cnt, p4, p5, p2 );
+    sum.AddTetra( 1.0, cnt, p0, p2, p3 );
+    sum.AddTetra( 1.0, cnt, p3, p5, p2 );
 }
 
 //==== Check Current Geom For Problems ====//
@@ -44,8 +44,7 @@ class MeshGeom : public Geom
 private:
     int m_BigEndianFlag;
 
-    vector< TTri* > m_IndexedTriVec;
-    vector< TNode* > m_IndexedNodeVec;
+    TMeshExportIndex m_ExportIndex;
 
     vector< TMesh* > m_SliceVec;
 
@@ -93,6 +92,7 @@ public:
     virtual void load_normals();
     virtual void UpdateBBox();
     virtual void UpdateDrawObj();
+    int GetDrawType();
 
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -112,11 +112,11 @@ public:
     virtual void BuildIndexedMesh( int partOffset );
     virtual int  GetNumIndexedPnts()
     {
-        return m_IndexedNodeVec.size();
+        return m_ExportIndex.NumPnts();
     }
     virtual int  GetNumIndexedTris()
     {
-        return m_IndexedTriVec.size();
+        return m_ExportIndex.NumTris();
     }
     virtual int  GetNumIndexedParts()
     {
@@ -146,7 +146,10 @@ public:
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
     virtual void MassSliceX( int numSlice, bool writefile = true );
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
-    virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0 );
+    virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0,
+                            bool directFlag = false );
+    virtual void AreaSection( const vector< double > & locVec, vector< double > & areaVec,
+                              vector< vec3d > & centerVec, vector< int > & numContourVec );
 
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
     virtual void WaveDragSlice( int numSlices, double sliceAngle, int coneSections,
@@ -159,8 +162,8 @@ public:
     virtual vec3d GetVertex3d( int surf, double x, double p, int r );
     //virtual void  getVertexVec(vector< VertexID > *vertVec);
 
-    virtual void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len );
-    virtual void createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec, TTri* tri, double len );
+    virtual void CreatePrism( MassPropSum & sum, TTri* tri, double len );
+    virtual void createDegenGeomPrism( MassPropSum & sum, TTri* tri, double len );
 
     virtual void AddPointMass( TetraMassProp* pm )
     {
@@ -199,6 +202,12 @@ public:
 
 protected:
     virtual void ApplyScale(); // this is for intersectTrim
+    virtual void IntersectSplitTMeshVec();
+    virtual void ComputeTrimTotals();
+    virtual void IntersectSliceMesh( TMesh* tm );
+    virtual void WaveSliceIntExt( TMesh* tm );
+    virtual void MassSliceSlab( TMesh* tm, double len, bool degenFlag, const map< string, int > & compIndMap,
+                                vector< MassPropSum > & sumVec, double & minDen, double & maxDen );
     vector<TMesh*> m_SubSurfVec;
 
 };
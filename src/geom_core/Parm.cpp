@@ -33,6 +33,7 @@ Parm::Parm()
     m_ActiveFlag = true;
     m_LinkUpdateFlag = false;
     m_ChangeCnt = 0;
+    m_Handle = -1;
 }
 
 //==== Destructor ====//
@@ -51,6 +52,7 @@ void Parm::Init( const string& name, const string& group_name, ParmContainer* co
                  double lower, double upper )
 {
     m_ID = GenerateID();
+    m_Handle = ParmMgr.InternID( m_ID );
     Set( val );
     SetLowerUpperLimits( lower, upper );
     m_Name = name;
@@ -92,6 +94,7 @@ void Parm::ChangeID( const string& newID )
     ParmMgr.RemoveParm( this );
 
     m_ID = newID;
+    m_Handle = ParmMgr.InternID( m_ID );
 
     ParmMgr.AddParm( this );
 
@@ -142,7 +145,11 @@ bool Parm::SetValCheckLimits( double val )
         m_Val = val;
     }
 
-    m_ChangeCnt = ParmMgr.GetChangeCnt();
+    //==== Deferred Sets Are Stamped In Order When Merged ====//
+    if ( !ParmMgr.DeferringSets() )
+    {
+        m_ChangeCnt = ParmMgr.GetChangeCnt();
+    }
 
     return true;
 }
@@ -160,11 +167,34 @@ double Parm::Set( double val )
         m_Container->ParmChanged( this, SET );
     }
 
-    LinkMgr.ParmChanged( m_ID, true );
+    if ( ParmMgr.DeferSet( this ) )
+    {
+        return m_Val;
+    }
+
+    NotifySet();
 
     return m_Val;
 }
 
+//==== Stamp Change Count Skipped While Set Was Deferred ====//
+void Parm::StampChangeCnt()
+{
+    m_ChangeCnt = ParmMgr.GetChangeCnt();
+}
+
+//==== Run Link And Transaction Steps Of A Set ====//
+void Parm::NotifySet()
+{
+    if ( ParmMgr.InTransaction() )
+    {
+        ParmMgr.AddTransactionParm( m_ID );
+        return;
+    }
+
+    LinkMgr.ParmChanged( m_Handle, true );
+}
+
 //==== Set Val And Notify Container and Parm Link Mgr ====//
 double Parm::SetFromLink( double val )
 {
@@ -173,7 +203,7 @@ double Parm::SetFromLink( double val )
         return m_Val;
     }
 
-    LinkMgr.ParmChanged( m_ID, false );
+    LinkMgr.ParmChanged( m_Handle, false );
 
     if ( m_Container )
     {
@@ -188,17 +218,32 @@ double Parm::SetFromDevice( double val, bool drag_flag )
 {
     if ( !SetValCheckLimits( val ) )
     {
+        if ( !drag_flag )
+        {
+            ParmMgr.EndUndoGesture();
+        }
         return m_Val;
     }
 
     ParmMgr.AddToUndoStack( this, drag_flag );
 
+    //==== Update Is Deferred To Commit ====//
+    if ( ParmMgr.InTransaction() )
+    {
+        if ( m_Container )
+        {
+            m_Container->ParmChanged( this, SET );
+        }
+        ParmMgr.AddTransactionParm( m_ID );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this,  SET_FROM_DEVICE );
     }
 
-    LinkMgr.ParmChanged( m_ID, true );
+    LinkMgr.ParmChanged( m_Handle, true );
 
     return m_Val;
 }
@@ -550,7 +595,12 @@ double FractionParm::Set( double val )
         m_Container->ParmChanged( this, SET );
     }
 
-    LinkMgr.ParmChanged( m_ID, true );
+    if ( ParmMgr.DeferSet( this ) )
+    {
+        return m_Val;
+    }
+
+    NotifySet();
 
     return m_Val;
 }
@@ -564,7 +614,7 @@ double FractionParm::SetFromLink( double val )
 
     UpdateResultVal();
 
-    LinkMgr.ParmChanged( m_ID, false );
+    LinkMgr.ParmChanged( m_Handle, false );
 
     if ( m_Container )
     {
@@ -580,6 +630,10 @@ double FractionParm::SetFromDevice( double val, bool drag_flag )
 {
     if ( !SetValCheckLimits( val ) )
     {
+        if ( !drag_flag )
+        {
+            ParmMgr.EndUndoGesture();
+        }
         return m_Val;
     }
 
@@ -587,12 +641,23 @@ double FractionParm::SetFromDevice( double val, bool drag_flag )
 
     UpdateResultVal();
 
+    //==== Update Is Deferred To Commit ====//
+    if ( ParmMgr.InTransaction() )
+    {
+        if ( m_Container )
+        {
+            m_Container->ParmChanged( this, SET );
+        }
+        ParmMgr.AddTransactionParm( m_ID );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this,  SET_FROM_DEVICE );
     }
 
-    LinkMgr.ParmChanged( m_ID, true );
+    LinkMgr.ParmChanged( m_Handle, true );
 
     return m_Val;
 }
@@ -67,6 +67,7 @@ public:
         return m_ID;
     }
     virtual void ChangeID( const string& newID );
+    int GetHandle() const                       { return m_Handle; }
 
     virtual int  GetType() const
     {
@@ -79,6 +80,10 @@ public:
     virtual double SetFromLink( double val );
     virtual double SetFromDevice( double val, bool drag_flag = false );
 
+    //==== Steps A Deferred Set Skipped - Run In Order When Merged ====//
+    virtual void StampChangeCnt();
+    virtual void NotifySet();
+
     virtual void SetLowerLimit( double limit );
     virtual void SetUpperLimit( double limit );
     virtual void SetLowerUpperLimits( double lower_limit, double upper_limit );
@@ -164,6 +169,7 @@ public:
 protected:
 
     string m_ID;
+    int m_Handle;                   // Interned m_ID
 
     string m_Name;
     string m_GroupName;
@@ -45,6 +45,7 @@ public:
     virtual ParmContainer* GetParentContainerPtr();
 
     virtual void SetLateUpdateFlag( bool flag )     { m_LateUpdateFlag = flag; }
+    virtual bool GetLateUpdateFlag()                { return m_LateUpdateFlag; }
     virtual int GetLatestChangeCnt();
 
     virtual string GetID()                          { return m_ID; }
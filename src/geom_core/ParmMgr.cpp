@@ -8,18 +8,31 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "ParmMgr.h"
+#include "LinkMgr.h"
+#include "Vehicle.h"
 
 using std::map;
 using std::string;
 using std::unordered_map;
 
+//==== Per Thread Record Of Deferred Sets, NULL When Not Deferring ====//
+static vector< Parm* > * s_DeferredSetVec = NULL;
+#pragma omp threadprivate( s_DeferredSetVec )
 
 //==== Constructor ====//
 ParmMgrSingleton::ParmMgrSingleton()
 {
     m_NumParmChanges = 0;
     m_ChangeCnt = 0;
-    m_LastUndoFlag = false;
+    m_HandleFreeCnt = 0;
+    m_TransactionDepth = 0;
+    m_TransactionUndoGroup = 0;
+    m_UndoMemUse = 0;
+    m_UndoMemLimit = 0;
+    m_UndoGroupCnt = 0;
+    m_UndoDragHandle = -1;
+    m_UndoDragGroup = 0;
+    m_UndoBlockFlag = false;
     m_LastReset = "";
 }
 
@@ -39,28 +52,47 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
     }
 
     //==== Check If Already Added ====//
-    if ( m_ParmMap.find( p->GetID() ) != m_ParmMap.end() )
+    int slot = InternID( id ) & HANDLE_SLOT_MASK;
+    if ( m_HandleParmVec[slot] )
     {
         return false;
     }
 
     m_NumParmChanges++;
-    m_ParmMap[id] = p;
+    m_HandleParmVec[slot] = p;
 
     return true;
 }
 
-//==== Remove Parm From Map ====//
+//==== Remove Parm From Map And Free Its Slot For Reuse ====//
 void ParmMgrSingleton::RemoveParm( Parm* p  )
 {
-    unordered_map< string, Parm* >::iterator iter;
-    iter = m_ParmMap.find( p->GetID() );
+    int handle = FindHandle( p->GetID() );
 
-    if ( iter !=  m_ParmMap.end() && iter->second == p )
+    if ( FindParm( handle ) != p )
     {
-        m_NumParmChanges++;
-        m_ParmMap.erase( iter );
+        return;
+    }
+
+    m_NumParmChanges++;
+
+    int slot = handle & HANDLE_SLOT_MASK;
+    int gen = ( handle >> HANDLE_SLOT_BITS ) + 1;
+
+    m_HandleMap.erase( m_HandleIDVec[slot] );
+    string().swap( m_HandleIDVec[slot] );
+    m_HandleParmVec[slot] = NULL;
+    m_HandleFreeCnt++;
+
+    //==== Retired Slot Matches No Handle And Is Never Reused ====//
+    if ( gen > HANDLE_GEN_MASK )
+    {
+        m_SlotHandleVec[slot] = -1;
+        return;
     }
+
+    m_SlotHandleVec[slot] = slot | ( gen << HANDLE_SLOT_BITS );
+    m_FreeSlotVec.push_back( slot );
 }
 
 //==== Add Parm Container To Map ====//
@@ -89,24 +121,78 @@ void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
 //==== Find Parm GivenID ====//
 Parm* ParmMgrSingleton::FindParm( const string & id )
 {
-    unordered_map< string, Parm* >::iterator iter;
+    return FindParm( FindHandle( id ) );
+}
 
-    iter = m_ParmMap.find( id );
-    if ( iter != m_ParmMap.end() )
+//==== Get Handle For ID, Adding It To The Table If New ====//
+int ParmMgrSingleton::InternID( const string & id )
+{
+    unordered_map< string, int >::iterator iter = m_HandleMap.find( id );
+    if ( iter != m_HandleMap.end() )
     {
         return iter->second;
     }
-    return NULL;
+
+    int slot;
+    if ( !m_FreeSlotVec.empty() )
+    {
+        slot = m_FreeSlotVec.back();
+        m_FreeSlotVec.pop_back();
+        m_HandleIDVec[slot] = id;
+    }
+    else
+    {
+        slot = ( int )m_SlotHandleVec.size();
+        m_SlotHandleVec.push_back( slot );
+        m_HandleIDVec.push_back( id );
+        m_HandleParmVec.push_back( NULL );
+    }
+
+    int handle = m_SlotHandleVec[slot];
+    m_HandleMap[id] = handle;
+
+    return handle;
+}
+
+//==== Get Handle For ID Without Adding It - Returns -1 If Not Found ====//
+int ParmMgrSingleton::FindHandle( const string & id )
+{
+    unordered_map< string, int >::iterator iter = m_HandleMap.find( id );
+    if ( iter != m_HandleMap.end() )
+    {
+        return iter->second;
+    }
+    return -1;
+}
+
+string ParmMgrSingleton::GetHandleID( int handle )
+{
+    if ( ValidHandle( handle ) )
+    {
+        return m_HandleIDVec[ handle & HANDLE_SLOT_MASK ];
+    }
+    return string();
+}
+
+//==== Find Parms Whose Values Changed After Change Count cnt ====//
+void ParmMgrSingleton::FindChangedParms( int cnt, vector< Parm* > & parm_vec )
+{
+    for ( int i = 0 ; i < ( int )m_HandleParmVec.size() ; i++ )
+    {
+        Parm* p = m_HandleParmVec[i];
+        if ( p && p->GetChangeCnt() > cnt )
+        {
+            parm_vec.push_back( p );
+        }
+    }
 }
 
 //==== Find Parm Name Group Container ====//
 string ParmMgrSingleton::FindParmID( const string & name, const string & group, const string & container )
 {
-    unordered_map< string, Parm* >::iterator iter;
-
-    for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; iter++ )
+    for ( int i = 0 ; i < ( int )m_HandleParmVec.size() ; i++ )
     {
-        Parm* parm_ptr = iter->second;
+        Parm* parm_ptr = m_HandleParmVec[i];
         if ( parm_ptr )
         {
             if ( name == parm_ptr->GetName() && 
@@ -139,39 +225,119 @@ ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 //==== Add Parm To Undo Stack ====//
 void ParmMgrSingleton::AddToUndoStack( Parm* parm_ptr, bool drag_flag )
 {
-    ParmUndo undo( parm_ptr );
+    if ( m_UndoMemLimit == 0 || m_UndoBlockFlag )
+    {
+        return;
+    }
+
+    //==== Drag Steps Merge Into The Entry Their Gesture Started While It Is Still The Newest ====//
+    if ( drag_flag && m_UndoDragHandle == parm_ptr->GetHandle() && !InTransaction() &&
+         !m_ParmUndoJournal.empty() && m_ParmUndoJournal.back().GetGroup() == m_UndoDragGroup )
+    {
+        return;
+    }
+
+    //==== A Transaction Is Undone In One Step ====//
+    int group;
+    if ( InTransaction() )
+    {
+        group = m_TransactionUndoGroup;
+        m_UndoDragHandle = -1;
+    }
+    else
+    {
+        //==== Every New Group Starts A New Gesture - A Push Or First Drag Step ====//
+        m_UndoGroupCnt++;
+        group = m_UndoGroupCnt;
+        m_UndoDragHandle = parm_ptr->GetHandle();
+        m_UndoDragGroup = group;
+    }
 
-    if ( !drag_flag )
+    if ( m_ParmUndoJournal.empty() || m_ParmUndoJournal.back().GetGroup() != group )
     {
-        if ( m_LastUndoFlag )
-            m_ParmUndoStack.push( m_LastUndo );
-        m_LastUndo = undo;
-        m_LastUndoFlag = true;
+        m_UndoGroupParmSet.clear();
+    }
+
+    //==== Only The First Value In A Group Is Needed To Undo It ====//
+    if ( !m_UndoGroupParmSet.insert( parm_ptr->GetHandle() ).second )
+    {
+        return;
     }
+
+    ParmUndo undo( parm_ptr, group );
+    m_UndoMemUse += undo.GetMemSize();
+    m_ParmUndoJournal.push_back( undo );
+
+    SetUndoMemLimit( m_UndoMemLimit );
 }
 
-//==== Add Parm To Undo Stack ====//
-void ParmMgrSingleton::UnDo()
+//==== A Push That Sets Nothing (e.g. Grabbing A Slider Knob) Still Ends The Previous Drag ====//
+void ParmMgrSingleton::EndUndoGesture()
 {
-    if ( m_LastUndoFlag )
+    m_UndoDragHandle = -1;
+}
+
+//==== Drop Oldest Groups Until The Journal Fits - The Newest Group Is Always Kept ====//
+void ParmMgrSingleton::SetUndoMemLimit( size_t limit )
+{
+    m_UndoMemLimit = limit;
+
+    if ( m_UndoMemLimit == 0 )
+    {
+        ClearUndo();
+        return;
+    }
+
+    while ( m_UndoMemUse > m_UndoMemLimit && !m_ParmUndoJournal.empty() &&
+            m_ParmUndoJournal.front().GetGroup() != m_ParmUndoJournal.back().GetGroup() )
     {
-        m_ParmUndoStack.push( m_LastUndo );
-        m_LastUndoFlag = false;
+        int group = m_ParmUndoJournal.front().GetGroup();
+        while ( !m_ParmUndoJournal.empty() && m_ParmUndoJournal.front().GetGroup() == group )
+        {
+            m_UndoMemUse -= m_ParmUndoJournal.front().GetMemSize();
+            m_ParmUndoJournal.pop_front();
+        }
     }
+}
 
-    if ( m_ParmUndoStack.size() == 0 )          // Nothing To Undo
+void ParmMgrSingleton::ClearUndo()
+{
+    std::deque< ParmUndo >().swap( m_ParmUndoJournal );
+    m_UndoGroupParmSet.clear();
+    m_UndoDragHandle = -1;
+    m_UndoMemUse = 0;
+}
+
+//==== Undo The Newest Group With A Single Update ====//
+void ParmMgrSingleton::UnDo()
+{
+    if ( m_ParmUndoJournal.size() == 0 )          // Nothing To Undo
     {
         return;
     }
 
-    ParmUndo top = m_ParmUndoStack.top();       // Top Undo
-    m_ParmUndoStack.pop();                      // Remove It
+    int group = m_ParmUndoJournal.back().GetGroup();
+
+    m_UndoBlockFlag = true;                     // Don't Add Restored Vals To Journal
+    m_UndoDragHandle = -1;
+    m_UndoGroupParmSet.clear();
 
-    Parm* parm_ptr = FindParm( top.GetID() );
-    if ( parm_ptr )
+    BeginTransaction();
+    while ( !m_ParmUndoJournal.empty() && m_ParmUndoJournal.back().GetGroup() == group )
     {
-        parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val - Don't Add To Stack
+        ParmUndo top = m_ParmUndoJournal.back();
+        m_UndoMemUse -= top.GetMemSize();
+        m_ParmUndoJournal.pop_back();
+
+        Parm* parm_ptr = FindParm( top.GetHandle() );       // NULL If The Parm Was Removed
+        if ( parm_ptr )
+        {
+            parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val
+        }
     }
+    CommitTransaction();
+
+    m_UndoBlockFlag = false;
 }
 
 //==== Create A Unique ID  =====//
@@ -324,3 +490,106 @@ Parm* ParmMgrSingleton::CreateParm( int type )
     }
     return p;
 }
+
+//==== Record Parm Set While Transaction Is Open ====//
+void ParmMgrSingleton::AddTransactionParm( const string & pid )
+{
+    if ( m_TransactionParmSet.insert( pid ).second )
+    {
+        m_TransactionParmVec.push_back( pid );
+    }
+}
+
+//==== Open Transaction - Its Sets Share One Undo Group ====//
+void ParmMgrSingleton::BeginTransaction()
+{
+    if ( m_TransactionDepth == 0 )
+    {
+        m_UndoGroupCnt++;
+        m_TransactionUndoGroup = m_UndoGroupCnt;
+        m_UndoDragHandle = -1;
+    }
+    m_TransactionDepth++;
+}
+
+//==== Close Transaction - Propagate Links And Update Once ====//
+void ParmMgrSingleton::CommitTransaction()
+{
+    if ( m_TransactionDepth <= 0 )
+    {
+        return;
+    }
+
+    m_TransactionDepth--;
+    if ( m_TransactionDepth > 0 )
+    {
+        return;
+    }
+
+    vector< string > pid_vec;
+    pid_vec.swap( m_TransactionParmVec );
+    m_TransactionParmSet.clear();
+
+    LinkMgr.ParmsChanged( pid_vec );
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( veh )
+    {
+        veh->Update();
+        veh->ParmChanged( NULL, Parm::SET );
+    }
+}
+
+//==== Close Levels Left Open Above Depth - Sets Made So Far Are Kept And Propagated ====//
+void ParmMgrSingleton::EndTransaction( int depth )
+{
+    if ( depth < 0 )
+    {
+        depth = 0;
+    }
+
+    if ( m_TransactionDepth <= depth )
+    {
+        return;
+    }
+
+    m_TransactionDepth = depth + 1;
+    CommitTransaction();
+}
+
+//==== Drop Open Transaction Without Propagating - Model Is Being Cleared ====//
+void ParmMgrSingleton::ResetTransaction()
+{
+    m_TransactionDepth = 0;
+    m_TransactionParmVec.clear();
+    m_TransactionParmSet.clear();
+}
+
+//==== Start Recording Sets On This Thread Instead Of Counting And Propagating Them ====//
+void ParmMgrSingleton::BeginDeferredSets( vector< Parm* > * parm_vec )
+{
+    s_DeferredSetVec = parm_vec;
+}
+
+//==== Stop Recording Sets On This Thread ====//
+void ParmMgrSingleton::EndDeferredSets()
+{
+    s_DeferredSetVec = NULL;
+}
+
+bool ParmMgrSingleton::DeferringSets()
+{
+    return s_DeferredSetVec != NULL;
+}
+
+//==== Record Set If Deferring - Caller Skips Its Link And Transaction Steps ====//
+bool ParmMgrSingleton::DeferSet( Parm* parm_ptr )
+{
+    if ( !s_DeferredSetVec )
+    {
+        return false;
+    }
+
+    s_DeferredSetVec->push_back( parm_ptr );
+    return true;
+}
@@ -19,7 +19,8 @@
 
 #include <map>
 #include <unordered_map>
-#include <stack>
+#include <deque>
+#include <set>
 
 using std::string;
 using std::unordered_map;
@@ -33,13 +34,25 @@ private:
     ParmMgrSingleton( ParmMgrSingleton const& copy );          // Not Implemented
     ParmMgrSingleton& operator=( ParmMgrSingleton const& copy ); // Not Implemented
 
-    bool m_LastUndoFlag;
-    ParmUndo m_LastUndo;
-    std::stack< ParmUndo > m_ParmUndoStack;
+    //==== Undo Journal - Oldest Groups Are Dropped Past The Memory Limit ====//
+    std::deque< ParmUndo > m_ParmUndoJournal;
+    size_t m_UndoMemUse;
+    size_t m_UndoMemLimit;                              // Zero Turns The Journal Off
+    int m_UndoGroupCnt;
+    std::set< int > m_UndoGroupParmSet;                 // Parm Handles Already Journaled In The Newest Group
+    int m_UndoDragHandle;                               // Parm Being Dragged, Steps Merge Into One Entry
+    int m_UndoDragGroup;                                // Group The Drag Gesture Started
+    bool m_UndoBlockFlag;
 
     string m_ActiveParmID;
 
-    unordered_map< string, Parm* > m_ParmMap;                       // ID->Parm Map
+    //==== Interned Parm IDs - A Handle Is A Slot In The Vecs Below Plus The Slot Generation ====//
+    unordered_map< string, int > m_HandleMap;                       // ID->Handle Map
+    vector< int > m_SlotHandleVec;                                  // Slot->Current Handle
+    vector< string > m_HandleIDVec;                                 // Slot->ID
+    vector< Parm* > m_HandleParmVec;                                // Slot->Parm, NULL If Removed
+    vector< int > m_FreeSlotVec;                                    // Slots Of Removed Parms, Reused First
+    int m_HandleFreeCnt;                                            // Bumped Whenever A Slot Is Freed
     unordered_map< string, ParmContainer* > m_ParmContainerMap;     // ID->Parm Container Map
 
     unordered_map< string, string > m_IDRemap;                      // oldID->newID Map
@@ -48,6 +61,11 @@ private:
     int m_NumParmChanges;
     int m_ChangeCnt;
 
+    int m_TransactionDepth;
+    int m_TransactionUndoGroup;
+    vector< string > m_TransactionParmVec;              // Parms Set During Open Transaction In Set Order
+    std::set< string > m_TransactionParmSet;
+
     string RemapID( const string & oldID, const string & suggestID, int size );
 
 public:
@@ -63,12 +81,44 @@ public:
     void RemoveParmContainer( ParmContainer* parm_container_ptr );
 
     Parm* FindParm( const string & id );
+    Parm* FindParm( int handle )
+    {
+        if ( ValidHandle( handle ) )
+        {
+            return m_HandleParmVec[ handle & HANDLE_SLOT_MASK ];
+        }
+        return NULL;
+    }
+
+    //==== String <-> Handle Table - API Keeps String IDs, Internal Traversal Uses Handles ====//
+    // Removing a parm frees its slot.  The slot generation is bumped, so stale handles
+    // resolve to NULL; holders re-intern their IDs when GetHandleFreeCnt() moves.  A slot
+    // whose generation is used up is retired rather than wrapped, so a stale handle can
+    // never alias a later parm.
+    enum { HANDLE_SLOT_BITS = 21, HANDLE_SLOT_MASK = ( 1 << HANDLE_SLOT_BITS ) - 1, HANDLE_GEN_MASK = 0x3ff };
+    int InternID( const string & id );
+    int FindHandle( const string & id );
+    string GetHandleID( int handle );
+    bool ValidHandle( int handle )
+    {
+        int slot = handle & HANDLE_SLOT_MASK;
+        return handle >= 0 && slot < ( int )m_SlotHandleVec.size() && m_SlotHandleVec[slot] == handle;
+    }
+    int GetHandleFreeCnt()                  { return m_HandleFreeCnt; }
     string FindParmID( const string & name, const string & group, const string & container );
     ParmContainer* FindParmContainer( const string & id );
 
     void AddToUndoStack( Parm* parm_ptr, bool drag_flag );
+    void EndUndoGesture();
     void UnDo();
 
+    //==== Journal Is Off Until Someone Can Undo (The GUI) Sets A Limit ====//
+    enum { UNDO_DEFAULT_MEM_LIMIT = 4 * 1024 * 1024 };
+    void SetUndoMemLimit( size_t limit );
+    size_t GetUndoMemLimit()                { return m_UndoMemLimit; }
+    size_t GetUndoMemUse()                  { return m_UndoMemUse; }
+    void ClearUndo();
+
     string GenerateID( int length );
 
     string ForceRemapID( const string & oldID, int size );
@@ -80,6 +130,23 @@ public:
     int GetNumParmChanges()                 { return m_NumParmChanges; }
     void IncNumParmChanges()                { m_NumParmChanges++; }
     int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetLatestChangeCnt()                { return m_ChangeCnt; }
+    void FindChangedParms( int cnt, vector< Parm* > & parm_vec );
+
+    //==== Parm Set Transactions - Links And Updates Run Once On Commit ====//
+    void BeginTransaction();
+    void CommitTransaction();
+    void EndTransaction( int depth = 0 );
+    void ResetTransaction();
+    bool InTransaction()                    { return m_TransactionDepth > 0; }
+    int GetTransactionDepth()               { return m_TransactionDepth; }
+    void AddTransactionParm( const string & pid );
+
+    //==== Deferred Sets - Parms Set On This Thread Skip Shared Steps Until Merged ====//
+    void BeginDeferredSets( vector< Parm* > * parm_vec );
+    void EndDeferredSets();
+    bool DeferringSets();
+    bool DeferSet( Parm* parm_ptr );
 
     Parm* CreateParm( int type );
 
@@ -10,16 +10,16 @@
 //==== Constructor ====//
 ParmUndo::ParmUndo()
 {
-    m_ParmID = string( "NONE" );
-    m_Val = 0.0;
+    m_Handle = -1;
     m_LastVal = 0.0;
+    m_Group = 0;
 }
 
-ParmUndo::ParmUndo( Parm* parm_ptr )
+ParmUndo::ParmUndo( Parm* parm_ptr, int group )
 {
-    m_ParmID = parm_ptr->GetID();
-    m_Val = parm_ptr->Get();
+    m_Handle = parm_ptr->GetHandle();
     m_LastVal = parm_ptr->GetLastVal();
+    m_Group = group;
 }
 
 
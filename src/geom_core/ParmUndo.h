@@ -16,23 +16,27 @@
 
 #include <string>
 
-//==== Undo Data ====//
+//==== Undo Data - Interned Parm Handle And The Value To Restore ====//
 class ParmUndo
 {
 public:
 
     ParmUndo();
-    ParmUndo( Parm* parm_ptr );
+    ParmUndo( Parm* parm_ptr, int group );
 
-    string GetID()              { return m_ParmID; }
+    int GetHandle()             { return m_Handle; }
     double GetLastVal()         { return m_LastVal; }
     void SetLastVal( double v ) { m_LastVal = v; }
+    int GetGroup()              { return m_Group; }
+
+    //==== Approx Bytes Held By This Entry ====//
+    size_t GetMemSize()         { return sizeof( ParmUndo ); }
 
 protected:
 
-    string m_ParmID;
-    double m_Val;
+    int m_Handle;               // Stale Once The Parm Is Removed - Resolves To NULL
     double m_LastVal;
+    int m_Group;                // Entries Sharing A Group Are Undone Together
 
 };
 
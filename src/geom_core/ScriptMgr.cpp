@@ -11,6 +11,7 @@
 #include "ScriptMgr.h"
 
 #include "Parm.h"
+#include "ParmMgr.h"
 #include "Matrix.h"
 #include "VSP_Geom_API.h"
 #include "CustomGeom.h"
@@ -268,7 +269,12 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
     {
         ctx->SetArgDouble( 0, arg );
     }
+    int transaction_depth = ParmMgr.GetTransactionDepth();
     r = ctx->Execute();
+
+    //==== Close Parm Transactions The Script Left Open, Even If It Threw ====//
+    ParmMgr.EndTransaction( transaction_depth );
+
     if( r != asEXECUTION_FINISHED )
     {
         // The execution didn't complete as expected. Determine what happened.
@@ -2116,6 +2122,16 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "double SetParmValUpdate(const string & in geom_id, const string & in parm_name, const string & in parm_group_name, double val )",
                                     asFUNCTIONPR( vsp::SetParmValUpdate, ( const string &, const string &, const string &, double val ), double ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void BeginParmTransaction()", asFUNCTION( vsp::BeginParmTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void CommitParmTransaction()", asFUNCTION( vsp::CommitParmTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void EndParmTransaction()", asFUNCTION( vsp::EndParmTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void SetUndoMemLimit( int limit_bytes )", asFUNCTION( vsp::SetUndoMemLimit ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "int GetUndoMemLimit()", asFUNCTION( vsp::GetUndoMemLimit ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in parm_id )", asFUNCTIONPR( vsp::GetParmVal, ( const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in geom_id, const string & in name, const string & in group )",
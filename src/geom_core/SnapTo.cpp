@@ -23,6 +23,11 @@ SnapTo::SnapTo() : ParmContainer()
 
 SnapTo::~SnapTo()
 {
+    map< string, GeomMeshCache >::iterator iter;
+    for ( iter = m_MeshCacheMap.begin() ; iter != m_MeshCacheMap.end() ; ++iter )
+    {
+        ClearMeshCache( iter->second );
+    }
 }
 
 //==== Parm Changed ====//
@@ -56,33 +61,132 @@ void SnapTo::PreventCollision( const string & geom_id, const string & parm_id )
     AdjParmToMinDist( parm_id, inc_flag );
 }
 
-//===== Vectors of TMeshs with Bounding Boxes Already Set Up ====//
-bool SnapTo::CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec )
+void SnapTo::ClearMeshCache( GeomMeshCache & cache )
+{
+    for ( int i = 0 ; i < (int)cache.m_TMeshVec.size() ; i++ )
+    {
+        delete cache.m_TMeshVec[i];
+    }
+    cache.m_TMeshVec.clear();
+    cache.m_GeomPtr = NULL;
+    cache.m_TessSerialNum = -1;
+}
+
+//==== Drop Meshes Of Geoms That Were Deleted Or Replaced ====//
+void SnapTo::PurgeMeshCache()
 {
-    bool intsect_flag = false;
+    Vehicle* veh = VehicleMgr.GetVehicle();
 
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
+    map< string, GeomMeshCache >::iterator iter = m_MeshCacheMap.begin();
+    while ( iter != m_MeshCacheMap.end() )
     {
-        tmesh_vec[i]->LoadBndBox();
-        for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
+        if ( veh->FindGeom( iter->first ) != iter->second.m_GeomPtr )
         {
-            if ( tmesh_vec[i]->CheckIntersect( other_tmesh_vec[j] ) )
+            ClearMeshCache( iter->second );
+            m_MeshCacheMap.erase( iter++ );
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+//==== Meshes Are Rebuilt Only When The Geom Updated Since The Last Call ====//
+// When the tris still line up one to one (any transform change and most shape
+// changes while dragging) the new points are copied in and the BVH is refit.
+const vector< TMesh* > & SnapTo::GetGeomTMeshVec( Geom* geom_ptr )
+{
+    GeomMeshCache & cache = m_MeshCacheMap[ geom_ptr->GetID() ];
+
+    if ( cache.m_GeomPtr == geom_ptr && cache.m_TessSerialNum == geom_ptr->GetTessSerialNum() )
+    {
+        return cache.m_TMeshVec;
+    }
+
+    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();        // Must Delete!!!
+
+    bool refit_flag = ( cache.m_GeomPtr == geom_ptr && cache.m_TMeshVec.size() == tmesh_vec.size() );
+    for ( int i = 0 ; i < (int)tmesh_vec.size() && refit_flag ; i++ )
+    {
+        if ( cache.m_TMeshVec[i]->m_TVec.size() != tmesh_vec[i]->m_TVec.size() )
+        {
+            refit_flag = false;
+        }
+    }
+
+    if ( refit_flag )
+    {
+        for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
+        {
+            vector< TTri* > & cache_tvec = cache.m_TMeshVec[i]->m_TVec;
+            const vector< TTri* > & new_tvec = tmesh_vec[i]->m_TVec;
+            for ( int t = 0 ; t < (int)new_tvec.size() ; t++ )
             {
-                    intsect_flag = true;
-                    break;
+                cache_tvec[t]->m_N0->m_Pnt = new_tvec[t]->m_N0->m_Pnt;
+                cache_tvec[t]->m_N1->m_Pnt = new_tvec[t]->m_N1->m_Pnt;
+                cache_tvec[t]->m_N2->m_Pnt = new_tvec[t]->m_N2->m_Pnt;
+                cache_tvec[t]->m_Norm = new_tvec[t]->m_Norm;
             }
+            cache.m_TMeshVec[i]->RefitBndBox();
+            delete tmesh_vec[i];
+        }
+    }
+    else
+    {
+        ClearMeshCache( cache );
+        for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
+        {
+            tmesh_vec[i]->LoadBndBox();
+        }
+        cache.m_TMeshVec = tmesh_vec;
+    }
+
+    cache.m_GeomPtr = geom_ptr;
+    cache.m_TessSerialNum = geom_ptr->GetTessSerialNum();
+
+    return cache.m_TMeshVec;
+}
+
+//==== Cached Meshes Of All Other Geoms In The Collision Set - Owned By The Cache ====//
+void SnapTo::LoadOtherTMeshVec( const string & geom_id, vector< TMesh* > & other_tmesh_vec )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    PurgeMeshCache();
+
+    other_tmesh_vec.clear();
+    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
+    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
+    {
+        if ( geom_id == geom_id_vec[i] )
+            continue;
+
+        Geom* g_ptr = veh->FindGeom( geom_id_vec[i] );
+        if ( g_ptr )
+        {
+            const vector< TMesh* > & tvec = GetGeomTMeshVec( g_ptr );
+            other_tmesh_vec.insert( other_tmesh_vec.end(), tvec.begin(), tvec.end() );
         }
-        if ( intsect_flag )
-            break;
     }
+}
 
+//===== Vectors of TMeshs with Bounding Boxes Already Set Up ====//
+bool SnapTo::CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec )
+{
+    const vector< TMesh* > & tmesh_vec = GetGeomTMeshVec( geom_ptr );
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
-        delete tmesh_vec[i];
+        for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
+        {
+            if ( tmesh_vec[i]->CheckIntersect( other_tmesh_vec[j] ) )
+            {
+                return true;
+            }
+        }
     }
 
-    return intsect_flag;
+    return false;
 }
 
 //==== Returns Large Neg Number If Error and 0.0 If Collision ====//
@@ -98,13 +202,12 @@ double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > &
         return 0.0;
     }
 
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();        // Must Delete!!!
+    const vector< TMesh* > & tmesh_vec = GetGeomTMeshVec( geom_ptr );
 
     //==== Find Min Dist ====//
     double min_dist = 1.0e12;
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
-        tmesh_vec[i]->LoadBndBox();
         for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
         {
             double d =  tmesh_vec[i]->MinDistance(  other_tmesh_vec[j], min_dist );
@@ -112,11 +215,6 @@ double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > &
         }
     }
 
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
-    {
-        delete tmesh_vec[i];
-    }
-
     return min_dist;
 }
 
@@ -156,30 +254,9 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
 
     Vehicle* veh = VehicleMgr.GetVehicle();
 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
-
-    //==== Create TMeshes =====//
+    //==== Other Geoms Stay Put While This Parm Is Adjusted ====//
     vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    LoadOtherTMeshVec( geom_id, other_tmesh_vec );
 
     double direction = 1.0;
     if ( !inc_flag )
@@ -291,8 +368,6 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
             m_CollisionErrorFlag = vsp::COLLISION_CLEAR_NO_SOLUTION;
         parm_ptr->Set( revert_val );              // Restore Val
         veh->Update( false );
-        for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-            delete other_tmesh_vec[i];
         return;
     }
 
@@ -372,10 +447,6 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
     m_CollisionErrorFlag = vsp::COLLISION_OK;
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
-
     //==== Store Last Results ====//
     m_LastParmID = parm_id;
     m_LastParmVal = parm_ptr->Get();
@@ -398,38 +469,10 @@ void SnapTo::CheckClearance( )
     Geom* geom_ptr = select_vec[0];
     if ( !geom_ptr )    return;
     string geom_id = geom_ptr->GetID();
- 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
 
-    //==== Create TMeshes =====//
     vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    LoadOtherTMeshVec( geom_id, other_tmesh_vec );
 
     bool iflag;
     m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
-
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
-
-
-}
\ No newline at end of file
+}
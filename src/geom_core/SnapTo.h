@@ -15,6 +15,10 @@
 #include "ParmContainer.h"
 #include "TMesh.h"
 
+#include <map>
+
+using std::map;
+
 //==== SnapTo ====//
 class SnapTo : public ParmContainer
 {
@@ -40,6 +44,23 @@ public:
 
 protected:
 
+    //==== Meshes With Loaded BVHs Kept Per Geom Between Calls ====//
+    struct GeomMeshCache
+    {
+        GeomMeshCache() : m_GeomPtr( NULL ), m_TessSerialNum( -1 )     {}
+
+        Geom* m_GeomPtr;
+        int m_TessSerialNum;
+        vector< TMesh* > m_TMeshVec;
+    };
+
+    const vector< TMesh* > & GetGeomTMeshVec( Geom* geom_ptr );
+    void LoadOtherTMeshVec( const string & geom_id, vector< TMesh* > & other_tmesh_vec );
+    void ClearMeshCache( GeomMeshCache & cache );
+    void PurgeMeshCache();
+
+    map< string, GeomMeshCache > m_MeshCacheMap;
+
     //===== Store Last Values ====//
     string m_LastParmID;
     double m_LastParmVal;
@@ -25,6 +25,9 @@
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
+#include "Predicates.h"
+
+#include <algorithm>
 
 
 //===============================================//
@@ -266,6 +269,186 @@ TriShellMassProp::TriShellMassProp( string id, double mass_area_in, vec3d& p0, v
 
 }
 
+//=======================================================================//
+//=======================================================================//
+//=======================================================================//
+MassPropSum::MassPropSum( const vec3d & ref )
+{
+    m_Ref = ref;
+    for ( int i = 0 ; i < NUM_TERMS ; i++ )
+    {
+        m_Sum[i] = 0.0;
+        m_Comp[i] = 0.0;
+    }
+}
+
+void MassPropSum::Accum( int i, double val )
+{
+    double t = m_Sum[i] + val;
+    if ( std::abs( m_Sum[i] ) >= std::abs( val ) )
+    {
+        m_Comp[i] += ( m_Sum[i] - t ) + val;
+    }
+    else
+    {
+        m_Comp[i] += ( val - t ) + m_Sum[i];
+    }
+    m_Sum[i] = t;
+}
+
+//==== Add An Element Given Its Own Inertia About Its CG ====//
+void MassPropSum::Add( double weight, double vol, const vec3d & cg,
+                       double ixx, double iyy, double izz, double ixy, double ixz, double iyz )
+{
+    vec3d d = cg - m_Ref;
+
+    Accum( WEIGHT, weight );
+    Accum( VOL, vol );
+    Accum( MX, d.x() * weight );
+    Accum( MY, d.y() * weight );
+    Accum( MZ, d.z() * weight );
+
+    Accum( IXX, ixx + weight * ( d.y() * d.y() + d.z() * d.z() ) );
+    Accum( IYY, iyy + weight * ( d.x() * d.x() + d.z() * d.z() ) );
+    Accum( IZZ, izz + weight * ( d.x() * d.x() + d.y() * d.y() ) );
+
+    Accum( IXY, ixy + weight * ( d.x() * d.y() ) );
+    Accum( IXZ, ixz + weight * ( d.x() * d.z() ) );
+    Accum( IYZ, iyz + weight * ( d.y() * d.z() ) );
+}
+
+//==== Merge A Sum Taken About The Same Reference Point ====//
+void MassPropSum::Add( const MassPropSum & sum )
+{
+    for ( int i = 0 ; i < NUM_TERMS ; i++ )
+    {
+        Accum( i, sum.m_Sum[i] );
+        Accum( i, sum.m_Comp[i] );
+    }
+}
+
+//==== Same Integrals As TetraMassProp ====//
+void MassPropSum::AddTetra( double den, const vec3d & p0, const vec3d & p1, const vec3d & p2, const vec3d & p3 )
+{
+    vec3d v1 = p1 - p0;
+    vec3d v2 = p2 - p0;
+    vec3d v3 = p3 - p0;
+
+    vec3d cg = ( v1 + v2 + v3 ) * 0.25 + p0;
+
+    double vol = std::abs( tetra_volume( v1, v2, v3 ) );
+    double mass = den * vol;
+
+    double Ix = mass / 10.0 * ( v1.x() * v1.x() + v2.x() * v2.x() + v3.x() * v3.x() +
+                                v1.x() * v2.x() + v1.x() * v3.x() + v2.x() * v3.x() );
+
+    double Iy = mass / 10.0 * ( v1.y() * v1.y() + v2.y() * v2.y() + v3.y() * v3.y() +
+                                v1.y() * v2.y() + v1.y() * v3.y() + v2.y() * v3.y() );
+
+    double Iz = mass / 10.0 * ( v1.z() * v1.z() + v2.z() * v2.z() + v3.z() * v3.z() +
+                                v1.z() * v2.z() + v1.z() * v3.z() + v2.z() * v3.z() );
+
+    double ixy = mass / 20.0 * ( 2.0 * ( v1.x() * v1.y() + v2.x() * v2.y() + v3.x() * v3.y() ) +
+                                 v1.x() * v2.y() + v2.x() * v1.y() + v1.x() * v3.y() + v3.x() * v1.y() + v2.x() * v3.y() + v3.x() * v2.y() );
+
+    double iyz = mass / 20.0 * ( 2.0 * ( v1.y() * v1.z() + v2.y() * v2.z() + v3.y() * v3.z() ) +
+                                 v1.y() * v2.z() + v2.y() * v1.z() + v1.y() * v3.z() + v3.y() * v1.z() + v2.y() * v3.z() + v3.y() * v2.z() );
+
+    double ixz = mass / 20.0 * ( 2.0 * ( v1.x() * v1.z() + v2.x() * v2.z() + v3.x() * v3.z() ) +
+                                 v1.x() * v2.z() + v2.x() * v1.z() + v1.x() * v3.z() + v3.x() * v1.z() + v2.x() * v3.z() + v3.x() * v2.z() );
+
+    Add( mass, vol, cg, Iy + Iz, Ix + Iz, Ix + Iy, ixy, ixz, iyz );
+}
+
+vec3d MassPropSum::GetCG() const
+{
+    double weight = Total( WEIGHT );
+    if ( !weight )
+    {
+        return vec3d( 0, 0, 0 );
+    }
+    return m_Ref + vec3d( Total( MX ), Total( MY ), Total( MZ ) ) * ( 1.0 / weight );
+}
+
+//==== Shift Second Moments From m_Ref To The CG ====//
+void MassPropSum::GetInertia( double & ixx, double & iyy, double & izz, double & ixy, double & ixz, double & iyz ) const
+{
+    double weight = Total( WEIGHT );
+    vec3d d;
+    if ( weight )
+    {
+        d = vec3d( Total( MX ), Total( MY ), Total( MZ ) ) * ( 1.0 / weight );
+    }
+
+    ixx = Total( IXX ) - weight * ( d.y() * d.y() + d.z() * d.z() );
+    iyy = Total( IYY ) - weight * ( d.x() * d.x() + d.z() * d.z() );
+    izz = Total( IZZ ) - weight * ( d.x() * d.x() + d.y() * d.y() );
+
+    ixy = Total( IXY ) - weight * ( d.x() * d.y() );
+    ixz = Total( IXZ ) - weight * ( d.x() * d.z() );
+    iyz = Total( IYZ ) - weight * ( d.y() * d.z() );
+}
+
+//=======================================================================//
+//=======================================================================//
+//=======================================================================//
+void TMeshExportIndex::Clear()
+{
+    m_PntVec.clear();
+    m_TriVec.clear();
+    m_TagVec.clear();
+}
+
+//==== Merge Corners Closer Than tol And Drop Tris That Collapse ====//
+void TMeshExportIndex::Build( const vector< TTri* > & triVec, double tol )
+{
+    Clear();
+
+    int ntri = ( int )triVec.size();
+    if ( ntri == 0 )
+    {
+        return;
+    }
+
+    vector< vec3d > allPntVec( 3 * ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        allPntVec[3 * t]     = triVec[t]->m_N0->m_Pnt;
+        allPntVec[3 * t + 1] = triVec[t]->m_N1->m_Pnt;
+        allPntVec[3 * t + 2] = triVec[t]->m_N2->m_Pnt;
+    }
+
+    PntNodeCloud pnCloud;
+    pnCloud.AddPntNodes( allPntVec );
+    IndexPntNodes( pnCloud, tol );
+
+    m_PntVec.reserve( pnCloud.m_NumUsedPts );
+    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    {
+        if ( pnCloud.UsedNode( i ) )
+        {
+            m_PntVec.push_back( allPntVec[i] );
+        }
+    }
+
+    m_TriVec.reserve( 3 * ntri );
+    m_TagVec.reserve( ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        int n0 = pnCloud.GetNodeUsedIndex( 3 * t );
+        int n1 = pnCloud.GetNodeUsedIndex( 3 * t + 1 );
+        int n2 = pnCloud.GetNodeUsedIndex( 3 * t + 2 );
+
+        if ( n0 != n1 && n0 != n2 && n1 != n2 )
+        {
+            m_TriVec.push_back( n0 );
+            m_TriVec.push_back( n1 );
+            m_TriVec.push_back( n2 );
+            m_TagVec.push_back( SubSurfaceMgr.GetTag( triVec[t]->m_Tags ) );
+        }
+    }
+}
+
 //===========================================================================================================//
 //================================================ DegenGeom ================================================//
 //===========================================================================================================//
@@ -733,6 +916,45 @@ void TMesh::Intersect( TMesh* tm, bool UWFlag )
     m_TBox.Intersect( &tm->m_TBox, UWFlag );
 }
 
+void TMesh::Intersect( TMesh* tm, vector< TTriISectEdge > & isect_buf )
+{
+    m_TBox.Intersect( &tm->m_TBox, false, &isect_buf );
+}
+
+//==== Tri Count And Node Coordinates - Everything A Pair Intersection Depends On ====//
+void TMesh::ContentKey( vector< double > & key )
+{
+    key.clear();
+    key.reserve( 1 + 9 * m_TVec.size() );
+    key.push_back( ( double )m_TVec.size() );
+
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    {
+        TNode* nodes[3] = { m_TVec[t]->m_N0, m_TVec[t]->m_N1, m_TVec[t]->m_N2 };
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            key.push_back( nodes[k]->m_Pnt.x() );
+            key.push_back( nodes[k]->m_Pnt.y() );
+            key.push_back( nodes[k]->m_Pnt.z() );
+        }
+    }
+}
+
+//==== 64 Bit FNV-1a Hash Of A Content Key ====//
+unsigned long long TMesh::ContentHash( const vector< double > & key )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( int i = 0 ; i < ( int )key.size() ; i++ )
+    {
+        const unsigned char* bytes = ( const unsigned char* )&key[i];
+        for ( int b = 0 ; b < ( int )sizeof( double ) ; b++ )
+        {
+            hash = ( hash ^ bytes[b] ) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
 bool TMesh::CheckIntersect( TMesh* tm )
 {
     return m_TBox.CheckIntersect( &tm->m_TBox );
@@ -753,8 +975,12 @@ void TMesh::Split()
 }
 
 
-void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
+//==== Gather Leaf Tris (Split Pieces Or Unsplit Tris) and Their Ray Origins ====//
+void TMesh::LoadIntExtQueries( vector< TTri* > & triVec, vector< vec3d > & origVec )
 {
+    triVec.clear();
+    origVec.clear();
+
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
@@ -765,68 +991,81 @@ void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
             tri->m_InteriorFlag = 1;
             for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                triVec.push_back( tri->m_SplitVec[s] );
             }
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            triVec.push_back( tri );
         }
     }
+
+    origVec.resize( triVec.size() );
+    for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
+    {
+        TTri* tri = triVec[t];
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+        origVec[t] = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+    }
 }
 
-void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
+    vector< TTri* > triVec;
+    vector< vec3d > origVec;
+    LoadIntExtQueries( triVec, origVec );
+
+    vector< int > queryVec( triVec.size() );
+    for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
+    {
+        triVec[t]->m_InteriorFlag = 0;
+        queryVec[t] = t;
+    }
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
-    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+    //==== Only Tris Not Yet Found Inside Another Mesh Are Cast Again ====//
+    for ( int m = 0 ; m < ( int )meshVec.size() && !queryVec.empty() ; m++ )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            vector< vec3d > queryOrigVec( queryVec.size() );
+            for ( int q = 0 ; q < ( int )queryVec.size() ; q++ )
             {
-                tri->m_InteriorFlag = 1;
-                return ;
+                queryOrigVec[q] = origVec[queryVec[q]];
             }
-        }
-    }
-}
 
-void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
-{
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
-    {
-        TTri* tri = m_TVec[t];
+            vector< int > numCrossVec;
+            meshVec[m]->m_TBox.RayCastCount( queryOrigVec, dir, numCrossVec );
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            vector< int > outsideVec;
+            for ( int q = 0 ; q < ( int )queryVec.size() ; q++ )
             {
-                MassDeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                if ( numCrossVec[q] % 2 )
+                {
+                    triVec[queryVec[q]]->m_InteriorFlag = 1;
+                }
+                else
+                {
+                    outsideVec.push_back( queryVec[q] );
+                }
             }
-        }
-        else
-        {
-            MassDeterIntExtTri( tri, meshVec );
+            queryVec.swap( outsideVec );
         }
     }
 }
 
-
-void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 1;
-    int prior = -1;
+    vector< TTri* > triVec;
+    vector< vec3d > origVec;
+    LoadIntExtQueries( triVec, origVec );
+
+    for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
+    {
+        triVec[t]->m_InteriorFlag = 1;
+    }
+    vector< int > priorVec( triVec.size(), -1 );
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
@@ -834,16 +1073,18 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            vector< int > numCrossVec;
+            meshVec[m]->m_TBox.RayCastCount( origVec, dir, numCrossVec );
+
+            for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
             {
-                if ( meshVec[m]->m_MassPrior > prior )
+                if ( numCrossVec[t] % 2 && meshVec[m]->m_MassPrior > priorVec[t] )
                 {
+                    TTri* tri = triVec[t];
                     tri->m_InteriorFlag = 0;
                     tri->m_ID = meshVec[m]->m_PtrID;
                     tri->m_Mass = meshVec[m]->m_Density;
-                    prior = meshVec[m]->m_MassPrior;
+                    priorVec[t] = meshVec[m]->m_MassPrior;
                 }
             }
         }
@@ -852,32 +1093,15 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 
 void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
-    {
-        TTri* tri = m_TVec[t];
+    vector< TTri* > triVec;
+    vector< vec3d > origVec;
+    LoadIntExtQueries( triVec, origVec );
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                WaveDeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
-        {
-            WaveDeterIntExtTri( tri, meshVec );
-        }
+    for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
+    {
+        triVec[t]->m_InteriorFlag = 0;
     }
-}
-
-void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
-{
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
-    int prior = -1;
+    vector< int > priorVec( triVec.size(), -1 );
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
@@ -885,15 +1109,17 @@ void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            vector< int > numCrossVec;
+            meshVec[m]->m_TBox.RayCastCount( origVec, dir, numCrossVec );
+
+            for ( int t = 0 ; t < ( int )triVec.size() ; t++ )
             {
-                if ( meshVec[m]->m_MassPrior > prior )
+                if ( numCrossVec[t] % 2 && meshVec[m]->m_MassPrior > priorVec[t] )
                 {
+                    TTri* tri = triVec[t];
                     tri->m_InteriorFlag = 1;
                     tri->m_ID = meshVec[m]->m_PtrID;
-                    prior = meshVec[m]->m_MassPrior;
+                    priorVec[t] = meshVec[m]->m_MassPrior;
                 }
             }
         }
@@ -1213,6 +1439,12 @@ void TMesh::LoadBndBox()
     m_TBox.SplitBox();
 }
 
+//==== Node Points Moved But Tris Did Not Change - Keep The BVH Layout ====//
+void TMesh::RefitBndBox()
+{
+    m_TBox.Refit();
+}
+
 //==== Write STL Tris =====//
 void TMesh::WriteSTLTris( FILE* file_id, Matrix4d XFormMat )
 {
@@ -1313,9 +1545,6 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_InteriorFlag = 0;
@@ -1327,9 +1556,6 @@ TTri::TTri()
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -2028,7 +2254,8 @@ void TTri::TriangulateSplit( int flattenAxis )
 
         if ( !dupFlag )
         {
-            //==== Constrained Delaunay Trianglulation ====//
+            //==== Constrained Delaunay Trianglulation - Triangle Keeps Global State ====//
+            #pragma omp critical( triangle )
             triangulate ( "zpQ", &in, &out, ( struct triangulateio * ) NULL );
         }
 //fprintf(fp, "Triangulate in = %d out = %d \n", in.numberofpoints, out.numberofpoints );
@@ -2217,7 +2444,6 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 //===============================================//
 //===============================================//
 //===============================================//
-//===============================================//
 //                  TBndBox
 //===============================================//
 //===============================================//
@@ -2226,83 +2452,300 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 
 TBndBox::TBndBox()
 {
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        m_SBoxVec[i] = 0;
-    }
 }
 
 TBndBox::~TBndBox()
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+}
+
+void TBndBox::Reset()
+{
+    m_Box.Reset();
+    m_TriVec.clear();
+    m_NodeVec.clear();
+}
+
+//==== Half Surface Area Of A Box ====//
+static double BoxSurfArea( const BndBox & box )
+{
+    double dx = box.GetMax( 0 ) - box.GetMin( 0 );
+    double dy = box.GetMax( 1 ) - box.GetMin( 1 );
+    double dz = box.GetMax( 2 ) - box.GetMin( 2 );
+
+    if ( dx < 0.0 || dy < 0.0 || dz < 0.0 )
     {
-        delete m_SBoxVec[i];
+        return 0.0;
     }
+    return dx * dy + dy * dz + dz * dx;
 }
 
-void TBndBox::Reset()
+//==== Plain Axis Aligned Box Used While Building The BVH ====//
+struct BvhAABB
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+    double m_Min[3];
+    double m_Max[3];
+
+    void Reset()
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            m_Min[k] = 1.0e100;
+            m_Max[k] = -1.0e100;
+        }
+    }
+    void Update( const double* mn, const double* mx )
     {
-        delete m_SBoxVec[i];
-        m_SBoxVec[i] = 0;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            m_Min[k] = std::min( m_Min[k], mn[k] );
+            m_Max[k] = std::max( m_Max[k], mx[k] );
+        }
     }
+    double Area() const
+    {
+        double dx = m_Max[0] - m_Min[0];
+        double dy = m_Max[1] - m_Min[1];
+        double dz = m_Max[2] - m_Min[2];
+        if ( dx < 0.0 )
+        {
+            return 0.0;
+        }
+        return dx * dy + dy * dz + dz * dx;
+    }
+};
 
-    m_Box.Reset();
-    m_TriVec.clear();
-}
+//==== Tri Record Used While Building The BVH ====//
+struct BvhPrim
+{
+    BvhAABB m_Box;
+    double m_Cen[3];
+    TTri* m_Tri;
+};
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
+//==== Build Flattened BVH Over Tri Centroids Using Binned SAH ====//
 void TBndBox::SplitBox()
 {
-    int i;
-    if ( m_TriVec.size() > 32 )
+    m_NodeVec.clear();
+
+    int ntri = ( int )m_TriVec.size();
+    if ( ntri == 0 )
+    {
+        return;
+    }
+
+    //==== Per Tri Boxes and Centroids - Partitioned In Place So Ranges Stay Contiguous ====//
+    vector< BvhPrim > prim( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        TTri* t = m_TriVec[i];
+        prim[i].m_Box.Reset();
+        prim[i].m_Box.Update( t->m_N0->m_Pnt.v, t->m_N0->m_Pnt.v );
+        prim[i].m_Box.Update( t->m_N1->m_Pnt.v, t->m_N1->m_Pnt.v );
+        prim[i].m_Box.Update( t->m_N2->m_Pnt.v, t->m_N2->m_Pnt.v );
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            prim[i].m_Cen[k] = ( t->m_N0->m_Pnt[k] + t->m_N1->m_Pnt[k] + t->m_N2->m_Pnt[k] ) / 3.0;
+        }
+        prim[i].m_Tri = t;
+    }
+
+    //==== Node Boxes Come From The Parent Split, So Only The Root Needs A Full Pass ====//
+    vector< BvhAABB > node_box;
+    node_box.reserve( 2 * ntri );
+    node_box.push_back( BvhAABB() );
+    node_box[0].Reset();
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        node_box[0].Update( prim[i].m_Box.m_Min, prim[i].m_Box.m_Max );
+    }
+
+    //==== A Binary Tree With One Tri Per Leaf Has 2N - 1 Nodes ====//
+    m_NodeVec.reserve( 2 * ntri );
+    m_NodeVec.push_back( TBvhNode() );
+    m_NodeVec[0].m_Start = 0;
+    m_NodeVec[0].m_Count = ntri;
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
+        int n = stack.back();
+        stack.pop_back();
 
-        for ( i = 0 ; i < 8 ; i++ )
+        int start = m_NodeVec[n].m_Start;
+        int count = m_NodeVec[n].m_Count;
+
+        BvhAABB nbox = node_box[n];
+        m_NodeVec[n].m_Box = BndBox( vec3d( nbox.m_Min[0], nbox.m_Min[1], nbox.m_Min[2] ),
+                                     vec3d( nbox.m_Max[0], nbox.m_Max[1], nbox.m_Max[2] ) );
+
+        if ( count <= BVH_LEAF_MIN )
         {
-            m_SBoxVec[i] = new TBndBox();
+            continue;
         }
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        //==== Bin Centroids Along The Widest Axis Of The Node ====//
+        int axis = 0;
+        for ( int k = 1 ; k < 3 ; k++ )
         {
-            int cnt = 0;
-            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
+            if ( nbox.m_Max[k] - nbox.m_Min[k] > nbox.m_Max[axis] - nbox.m_Min[axis] )
             {
-                cnt += 1;
+                axis = k;
             }
-            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
+        }
+        double cmin = nbox.m_Min[axis];
+        double ext = nbox.m_Max[axis] - cmin;
+
+        int mid = -1;
+        BvhAABB lbest, rbest;
+        if ( ext > 0.0 )
+        {
+            double scale = BVH_NUM_BINS / ext;
+
+            BvhAABB bin_box[BVH_NUM_BINS];
+            int bin_cnt[BVH_NUM_BINS];
+            for ( int b = 0 ; b < BVH_NUM_BINS ; b++ )
             {
-                cnt += 2;
+                bin_box[b].Reset();
+                bin_cnt[b] = 0;
             }
-            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
+            for ( int i = start ; i < start + count ; i++ )
             {
-                cnt += 4;
+                int b = std::min( BVH_NUM_BINS - 1, ( int )( ( prim[i].m_Cen[axis] - cmin ) * scale ) );
+                bin_cnt[b]++;
+                bin_box[b].Update( prim[i].m_Box.m_Min, prim[i].m_Box.m_Max );
+            }
+
+            //==== Sweep From Right To Accumulate Right Side Boxes and Costs ====//
+            double right_cost[BVH_NUM_BINS];
+            BvhAABB right_box[BVH_NUM_BINS];
+            BvhAABB rbox;
+            rbox.Reset();
+            int rcnt = 0;
+            for ( int b = BVH_NUM_BINS - 1 ; b > 0 ; b-- )
+            {
+                rbox.Update( bin_box[b].m_Min, bin_box[b].m_Max );
+                rcnt += bin_cnt[b];
+                right_cost[b] = rcnt * rbox.Area();
+                right_box[b] = rbox;
             }
-            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
-        }
 
-        int contSplitFlag = 1;
+            double best_cost = 1.0e100;
+            int best_bin = -1;
+            BvhAABB lbox;
+            lbox.Reset();
+            int lcnt = 0;
+            for ( int b = 0 ; b < BVH_NUM_BINS - 1 ; b++ )
+            {
+                lbox.Update( bin_box[b].m_Min, bin_box[b].m_Max );
+                lcnt += bin_cnt[b];
+                if ( lcnt == 0 || lcnt == count )
+                {
+                    continue;
+                }
+                double cost = lcnt * lbox.Area() + right_cost[b + 1];
+                if ( cost < best_cost )
+                {
+                    best_cost = cost;
+                    best_bin = b;
+                    lbest = lbox;
+                    rbest = right_box[b + 1];
+                }
+            }
 
-        for ( i = 0 ; i < 8 ; i++ )
+            //==== Stop When Splitting Costs More Than Testing Every Tri ====//
+            if ( count <= BVH_LEAF_MAX && best_cost >= count * nbox.Area() )
+            {
+                continue;
+            }
+
+            if ( best_bin >= 0 )
+            {
+                vector< BvhPrim >::iterator split = std::partition( prim.begin() + start, prim.begin() + start + count,
+                                                    [&]( const BvhPrim & p )
+                {
+                    return std::min( BVH_NUM_BINS - 1, ( int )( ( p.m_Cen[axis] - cmin ) * scale ) ) <= best_bin;
+                } );
+                mid = ( int )( split - prim.begin() );
+            }
+        }
+
+        if ( mid < 0 )
         {
-            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
+            //==== All Centroids Share One Bin - Split The Range In Half ====//
+            if ( count <= BVH_LEAF_MAX )
             {
-                contSplitFlag = 0;
-                break;
+                continue;
+            }
+            mid = start + count / 2;
+            lbest.Reset();
+            rbest.Reset();
+            for ( int i = start ; i < mid ; i++ )
+            {
+                lbest.Update( prim[i].m_Box.m_Min, prim[i].m_Box.m_Max );
+            }
+            for ( int i = mid ; i < start + count ; i++ )
+            {
+                rbest.Update( prim[i].m_Box.m_Min, prim[i].m_Box.m_Max );
             }
         }
-        if ( contSplitFlag )
+
+        int left = ( int )m_NodeVec.size();
+        m_NodeVec.push_back( TBvhNode() );
+        m_NodeVec.push_back( TBvhNode() );
+        m_NodeVec[left].m_Start = start;
+        m_NodeVec[left].m_Count = mid - start;
+        m_NodeVec[left + 1].m_Start = mid;
+        m_NodeVec[left + 1].m_Count = start + count - mid;
+        node_box.push_back( lbest );
+        node_box.push_back( rbest );
+
+        m_NodeVec[n].m_Start = left;
+        m_NodeVec[n].m_Count = 0;
+
+        stack.push_back( left + 1 );
+        stack.push_back( left );
+    }
+
+    //==== Reorder Tris So Each Leaf References A Contiguous Range ====//
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        m_TriVec[i] = prim[i].m_Tri;
+    }
+}
+
+//==== Recompute Node Boxes After The Tri Points Move Without Repartitioning ====//
+void TBndBox::Refit()
+{
+    m_Box.Reset();
+    for ( int i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    {
+        m_Box.Update( m_TriVec[i]->m_N0->m_Pnt );
+        m_Box.Update( m_TriVec[i]->m_N1->m_Pnt );
+        m_Box.Update( m_TriVec[i]->m_N2->m_Pnt );
+    }
+
+    //==== Children Are Always Stored After Their Parent ====//
+    for ( int n = ( int )m_NodeVec.size() - 1 ; n >= 0 ; n-- )
+    {
+        TBvhNode & node = m_NodeVec[n];
+        node.m_Box.Reset();
+
+        if ( node.m_Count > 0 )
         {
-            for ( i = 0 ; i < 8 ; i++ )
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
             {
-                m_SBoxVec[i]->SplitBox();
+                node.m_Box.Update( m_TriVec[i]->m_N0->m_Pnt );
+                node.m_Box.Update( m_TriVec[i]->m_N1->m_Pnt );
+                node.m_Box.Update( m_TriVec[i]->m_N2->m_Pnt );
             }
         }
+        else
+        {
+            node.m_Box.Update( m_NodeVec[node.m_Start].m_Box );
+            node.m_Box.Update( m_NodeVec[node.m_Start + 1].m_Box );
+        }
     }
 }
 
@@ -2314,117 +2757,174 @@ void TBndBox::AddTri( TTri* t )
     m_Box.Update( t->m_N2->m_Pnt );
 }
 
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+//==== Descend Into The Node Pair Child With The Larger Box ====//
+static inline bool DescendFirst( const TBvhNode & n0, const TBvhNode & n1 )
 {
-    int i;
-
-    if ( m_SBoxVec[0] )     // Keep Moving Down
+    if ( n1.m_Count > 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
-        }
+        return true;
     }
-    else
+    if ( n0.m_Count > 0 )
     {
-        leafVec.push_back( this );
+        return false;
     }
+    return BoxSurfArea( n0.m_Box ) >= BoxSurfArea( n1.m_Box );
 }
 
 bool TBndBox::CheckIntersect( TBndBox* iBox  )
 {
-    int i, j;
-
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
         return false;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    vector< pair< int, int > > stack;
+    stack.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        int a = stack.back().first;
+        int b = stack.back().second;
+        const TBvhNode & n0 = m_NodeVec[a];
+        const TBvhNode & n1 = iBox->m_NodeVec[b];
+        stack.pop_back();
+
+        //==== Compare Bounding Boxes ====//
+        if ( !Compare( n0.m_Box, n1.m_Box ) )
         {
-           if ( iBox->CheckIntersect( m_SBoxVec[i] ) )
-           return true;
+            continue;
         }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
+
+        if ( n0.m_Count == 0 && DescendFirst( n0, n1 ) )
         {
-            if ( iBox->m_SBoxVec[i]->CheckIntersect( this ) )
-                return true;
+            stack.push_back( pair< int, int >( n0.m_Start + 1, b ) );
+            stack.push_back( pair< int, int >( n0.m_Start, b ) );
         }
-    }
-    else
-    {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
-
-        //==== Check All Tris In One Box Against The Other ====//
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        else if ( n1.m_Count == 0 )
+        {
+            stack.push_back( pair< int, int >( a, n1.m_Start + 1 ) );
+            stack.push_back( pair< int, int >( a, n1.m_Start ) );
+        }
+        else
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            //==== Check All Tris In One Leaf Against The Other ====//
+            for ( int i = n0.m_Start ; i < n0.m_Start + n0.m_Count ; i++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
+                TTri* t0 = m_TriVec[i];
+                for ( int j = n1.m_Start ; j < n1.m_Start + n1.m_Count ; j++ )
+                {
+                    TTri* t1 = iBox->m_TriVec[j];
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+                    int iflag = tri_tri_isect_exact( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                                     t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt,
+                                                     coplanarFlag, e0, e1 );
 
-                if ( iflag && !coplanarFlag )
-                    return true;
+                    if ( iflag && !coplanarFlag )
+                        return true;
+                }
             }
         }
     }
     return false;
 }
 
-double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+//==== Squared Gap Between Two Boxes - Zero If They Overlap ====//
+static inline double BoxDistSquared( const BndBox & b0, const BndBox & b1 )
 {
-    int i, j;
+    double d2 = 0.0;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        double gap = std::max( b0.GetMin( k ) - b1.GetMax( k ), b1.GetMin( k ) - b0.GetMax( k ) );
+        if ( gap > 0.0 )
+        {
+            d2 += gap * gap;
+        }
+    }
+    return d2;
+}
+
+//==== Node Pair Waiting On The Min Distance Stack ====//
+struct TBvhPairDist
+{
+    TBvhPairDist( int a, int b, double d2 ) : m_A( a ), m_B( b ), m_Dist2( d2 )     {}
+
+    int m_A;
+    int m_B;
+    double m_Dist2;
+};
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
+//==== Closest Point Traversal - Nearer Child Pairs First So The Bound Tightens Early ====//
+double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+{
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
         return curr_min_dist;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    vector< TBvhPairDist > stack;
+    stack.push_back( TBvhPairDist( 0, 0, BoxDistSquared( m_NodeVec[0].m_Box, iBox->m_NodeVec[0].m_Box ) ) );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        TBvhPairDist p = stack.back();
+        stack.pop_back();
+
+        //==== Box Gap Already Larger Than Best Tri Distance ====//
+        if ( p.m_Dist2 >= curr_min_dist * curr_min_dist )
         {
-            curr_min_dist = iBox->MinDistance( m_SBoxVec[i], curr_min_dist );
+            continue;
         }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
+
+        const TBvhNode & n0 = m_NodeVec[p.m_A];
+        const TBvhNode & n1 = iBox->m_NodeVec[p.m_B];
+
+        if ( n0.m_Count == 0 && DescendFirst( n0, n1 ) )
         {
-            curr_min_dist = iBox->m_SBoxVec[i]->MinDistance( this, curr_min_dist );
+            int c0 = n0.m_Start;
+            int c1 = n0.m_Start + 1;
+            double d0 = BoxDistSquared( m_NodeVec[c0].m_Box, n1.m_Box );
+            double d1 = BoxDistSquared( m_NodeVec[c1].m_Box, n1.m_Box );
+            if ( d0 > d1 )
+            {
+                std::swap( c0, c1 );
+                std::swap( d0, d1 );
+            }
+            stack.push_back( TBvhPairDist( c1, p.m_B, d1 ) );
+            stack.push_back( TBvhPairDist( c0, p.m_B, d0 ) );
         }
-    }
-    //==== Check All Points Against Other Points ====//
-    else
-    {
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        else if ( n1.m_Count == 0 )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            int c0 = n1.m_Start;
+            int c1 = n1.m_Start + 1;
+            double d0 = BoxDistSquared( n0.m_Box, iBox->m_NodeVec[c0].m_Box );
+            double d1 = BoxDistSquared( n0.m_Box, iBox->m_NodeVec[c1].m_Box );
+            if ( d0 > d1 )
             {
+                std::swap( c0, c1 );
+                std::swap( d0, d1 );
+            }
+            stack.push_back( TBvhPairDist( p.m_A, c1, d1 ) );
+            stack.push_back( TBvhPairDist( p.m_A, c0, d0 ) );
+        }
+        //==== Check All Points Against Other Points ====//
+        else
+        {
+            for ( int i = n0.m_Start ; i < n0.m_Start + n0.m_Count ; i++ )
+            {
+                TTri* t0 = m_TriVec[i];
+                for ( int j = n1.m_Start ; j < n1.m_Start + n1.m_Count ; j++ )
+                {
+                    TTri* t1 = iBox->m_TriVec[j];
+                    double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                                 t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
 
-                TTri* t1 = iBox->m_TriVec[j];
-                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
-                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
-
-                if ( d < curr_min_dist )
-                    curr_min_dist = d;
+                    if ( d < curr_min_dist )
+                        curr_min_dist = d;
+                }
             }
         }
     }
@@ -2433,293 +2933,550 @@ double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
 }
 
 
-void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
+void TBndBox::Intersect( TBndBox* iBox, bool UWFlag, vector< TTriISectEdge >* isect_buf )
 {
-    int i;
-
-    double tol = 1e-6; // was 1e-6
-
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    if ( m_NodeVec.empty() || iBox->m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    vector< pair< int, int > > stack;
+    stack.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        int a = stack.back().first;
+        int b = stack.back().second;
+        const TBvhNode & n0 = m_NodeVec[a];
+        const TBvhNode & n1 = iBox->m_NodeVec[b];
+        stack.pop_back();
+
+        if ( !Compare( n0.m_Box, n1.m_Box ) )
         {
-            iBox->Intersect( m_SBoxVec[i], UWFlag );
+            continue;
         }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
+
+        if ( n0.m_Count == 0 && DescendFirst( n0, n1 ) )
+        {
+            stack.push_back( pair< int, int >( n0.m_Start + 1, b ) );
+            stack.push_back( pair< int, int >( n0.m_Start, b ) );
+        }
+        else if ( n1.m_Count == 0 )
+        {
+            stack.push_back( pair< int, int >( a, n1.m_Start + 1 ) );
+            stack.push_back( pair< int, int >( a, n1.m_Start ) );
+        }
+        else
         {
-            iBox->m_SBoxVec[i]->Intersect( this, UWFlag );
+            IntersectLeaves( n0, iBox, n1, UWFlag, isect_buf );
         }
     }
-    else
-    {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
+}
 
-        int iCnt = 0;
+void TBndBox::IntersectLeaves( const TBvhNode & n0, TBndBox* iBox, const TBvhNode & n1, bool UWFlag, vector< TTriISectEdge >* isect_buf )
+{
+    double tol = 1e-6; // was 1e-6
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    for ( int i = n0.m_Start ; i < n0.m_Start + n0.m_Count ; i++ )
+    {
+        TTri* t0 = m_TriVec[i];
+        for ( int j = n1.m_Start ; j < n1.m_Start + n1.m_Count ; j++ )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
+            TTri* t1 = iBox->m_TriVec[j];
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+            int iflag = tri_tri_isect_exact( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt,
+                                             coplanarFlag, e0, e1 );
 
-                iCnt += iflag;
-                if ( iflag && !coplanarFlag )
+            if ( iflag && !coplanarFlag )
+            {
+                if ( UWFlag )
                 {
-                    if ( UWFlag )
+                    if ( dist( e0, e1 ) > tol ) // was 1e-6
                     {
-                        if ( dist( e0, e1 ) > tol ) // was 1e-6
+                        // Figure out with tri has xyz info
+                        TTri* tri;
+                        int d_info = TNode::HAS_XYZ; // desired info number
+                        if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                                && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
                         {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
+                            tri = t0;
+                        }
+                        else
+                        {
+                            tri = t1;
+                        }
+                        // Use Bilinear interpolation to convert edge uw points to xyz points
+                        vec3d e0xyz = tri->CompPnt( e0 );
+                        vec3d e1xyz = tri->CompPnt( e1 );
 
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
+                        // Create the new edges
 
-                        }
-                    }
-                    else
-                    {
                         TEdge* ie0 = new TEdge();
+                        int info = TNode::HAS_UW | TNode::HAS_XYZ;
                         ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
+                        ie0->m_N0->SetUWPnt( e0 );
+                        ie0->m_N0->SetXYZPnt( e0xyz );
+                        ie0->m_N0->MakePntUW();
+                        ie0->m_N0->SetCoordInfo( info );
                         ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
+                        ie0->m_N1->SetUWPnt( e1 );
+                        ie0->m_N1->SetXYZPnt( e1xyz );
+                        ie0->m_N1->MakePntUW();
+                        ie0->m_N1->SetCoordInfo( info );
 
                         TEdge* ie1 = new TEdge();
                         ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
+                        ie1->m_N0->SetUWPnt( e0 );
+                        ie1->m_N0->SetXYZPnt( e0xyz );
+                        ie1->m_N0->MakePntUW();
+                        ie1->m_N0->SetCoordInfo( info );
                         ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
+                        ie1->m_N1->SetUWPnt( e1 );
+                        ie1->m_N1->SetXYZPnt( e1xyz );
+                        ie1->m_N1->MakePntUW();
+                        ie1->m_N1->SetCoordInfo( info );
 
+                        t0->m_ISectEdgeVec.push_back( ie0 );
+                        t1->m_ISectEdgeVec.push_back( ie1 );
 
-                        if ( dist( e0, e1 ) > tol )
+                        if ( tri->GetTMeshPtr() )
                         {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
+                            tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                        }
+
+                    }
+                }
+                else
+                {
+                    TEdge* ie0 = new TEdge();
+                    ie0->m_N0 = new TNode();
+                    ie0->m_N0->m_Pnt = e0;
+                    ie0->m_N1 = new TNode();
+                    ie0->m_N1->m_Pnt = e1;
+
+                    TEdge* ie1 = new TEdge();
+                    ie1->m_N0 = new TNode();
+                    ie1->m_N0->m_Pnt = e0;
+                    ie1->m_N1 = new TNode();
+                    ie1->m_N1->m_Pnt = e1;
+
+
+                    if ( dist( e0, e1 ) > tol )
+                    {
+                        if ( isect_buf )
+                        {
+                            isect_buf->push_back( TTriISectEdge( t0, ie0 ) );
+                            isect_buf->push_back( TTriISectEdge( t1, ie1 ) );
                         }
                         else
                         {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
+                            t0->m_ISectEdgeVec.push_back( ie0 );
+                            t1->m_ISectEdgeVec.push_back( ie1 );
                         }
                     }
+                    else
+                    {
+                        delete ie0->m_N0;
+                        delete ie0->m_N1;
+                        delete ie1->m_N0;
+                        delete ie1->m_N1;
+                        delete ie0;
+                        delete ie1;
+                    }
                 }
             }
         }
     }
 }
+
 void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
 {
-    int i;
-
-    if ( orig.y() < m_Box.GetMin( 1 ) )
-    {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
+    if ( m_NodeVec.empty() )
     {
         return;
     }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
+
+    double tparm, uparm, vparm;
+    vec3d dir( 1.0, 0.0, 0.0 );
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        return;
+        const TBvhNode & n = m_NodeVec[stack.back()];
+        stack.pop_back();
+
+        const BndBox & box = n.m_Box;
+        if ( orig.y() < box.GetMin( 1 ) || orig.y() > box.GetMax( 1 ) ||
+             orig.z() < box.GetMin( 2 ) || orig.z() > box.GetMax( 2 ) ||
+             orig.x() > box.GetMax( 0 ) )
+        {
+            continue;
+        }
+
+        if ( n.m_Count == 0 )
+        {
+            stack.push_back( n.m_Start + 1 );
+            stack.push_back( n.m_Start );
+            continue;
+        }
+
+        //==== Check All Tris In Leaf ====//
+        for ( int i = n.m_Start ; i < n.m_Start + n.m_Count ; i++ )
+        {
+            TTri* tri = m_TriVec[i];
+            int iFlag = intersect_triangle( orig.v, dir.v,
+                                            tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+
+            if ( iFlag && tparm > 0.0 )
+            {
+                //==== Find If T is Already Included ====//
+                int dupFlag = 0;
+                for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+                {
+                    if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                    {
+                        dupFlag = 1;
+                        break;
+                    }
+                }
+
+                if ( !dupFlag )
+                {
+                    tParmVec.push_back( tparm );
+                }
+            }
+        }
     }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
+}
+
+void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+{
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    double coord[3];
+    double tparm, uparm, vparm;
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & n = m_NodeVec[stack.back()];
+        stack.pop_back();
+
+        if( !intersectRayAABB( n.m_Box.GetMin().v, n.m_Box.GetMax().v, orig.v, dir.v, coord ) )
         {
-            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
+            continue;
         }
-        return;
-    }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        if ( n.m_Count == 0 )
+        {
+            stack.push_back( n.m_Start + 1 );
+            stack.push_back( n.m_Start );
+            continue;
+        }
 
-        if ( iFlag && tparm > 0.0 )
+        //==== Check All Tris In Leaf ====//
+        for ( int i = n.m_Start ; i < n.m_Start + n.m_Count ; i++ )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            TTri* tri = m_TriVec[i];
+            int iFlag = intersect_triangle( orig.v, dir.v,
+                                            tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+
+            if ( iFlag && tparm > 0.0 )
             {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                //==== Find If T is Already Included ====//
+                int dupFlag = 0;
+                for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
                 {
-                    dupFlag = 1;
-                    break;
+                    if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                    {
+                        dupFlag = 1;
+                        break;
+                    }
                 }
-            }
 
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
+                if ( !dupFlag )
+                {
+                    tParmVec.push_back( tparm );
+                }
             }
         }
     }
+}
 
+//==== Interleave The Low 16 Bits Of x With Zeros ====//
+static unsigned int SpreadBits16( unsigned int x )
+{
+    x &= 0x0000ffff;
+    x = ( x | ( x << 8 ) ) & 0x00ff00ff;
+    x = ( x | ( x << 4 ) ) & 0x0f0f0f0f;
+    x = ( x | ( x << 2 ) ) & 0x33333333;
+    x = ( x | ( x << 1 ) ) & 0x55555555;
+    return x;
 }
 
-void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+//==== Order Ray Origins Along A Morton Curve In The Plane Normal To The Rays ====//
+static void SortRayOrigins( const vector< vec3d > & origVec, const vec3d & dir, vector< int > & orderVec )
 {
-    int i;
+    int nray = ( int )origVec.size();
 
-    double coord[3];
+    //==== Build Plane Axes Perpendicular To dir ====//
+    vec3d dn = dir;
+    dn.normalize();
+    vec3d ref( 1.0, 0.0, 0.0 );
+    if ( std::abs( dn.x() ) > 0.5 )
+    {
+        ref = vec3d( 0.0, 1.0, 0.0 );
+    }
+    vec3d ax0 = cross( dn, ref );
+    ax0.normalize();
+    vec3d ax1 = cross( dn, ax0 );
 
-    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
+    vector< double > s0( nray ), s1( nray );
+    double min0 = 1.0e100, max0 = -1.0e100, min1 = 1.0e100, max1 = -1.0e100;
+    for ( int i = 0 ; i < nray ; i++ )
     {
-        return;
+        s0[i] = dot( origVec[i], ax0 );
+        s1[i] = dot( origVec[i], ax1 );
+        min0 = std::min( min0, s0[i] );
+        max0 = std::max( max0, s0[i] );
+        min1 = std::min( min1, s1[i] );
+        max1 = std::max( max1, s1[i] );
     }
+    double scale0 = ( max0 > min0 ) ? 65535.0 / ( max0 - min0 ) : 0.0;
+    double scale1 = ( max1 > min1 ) ? 65535.0 / ( max1 - min1 ) : 0.0;
 
-    if ( m_SBoxVec[0] )
+    vector< pair< unsigned int, int > > keyVec( nray );
+    for ( int i = 0 ; i < nray ; i++ )
+    {
+        unsigned int q0 = ( unsigned int )( ( s0[i] - min0 ) * scale0 );
+        unsigned int q1 = ( unsigned int )( ( s1[i] - min1 ) * scale1 );
+        keyVec[i] = pair< unsigned int, int >( SpreadBits16( q0 ) | ( SpreadBits16( q1 ) << 1 ), i );
+    }
+    std::sort( keyVec.begin(), keyVec.end() );
+
+    orderVec.resize( nray );
+    for ( int i = 0 ; i < nray ; i++ )
+    {
+        orderVec[i] = keyVec[i].second;
+    }
+}
+
+//==== Count Distinct Crossings Of Many Rays Sharing One Direction ====//
+void TBndBox::RayCastCount( const vector< vec3d > & origVec, const vec3d & dir, vector< int > & numCrossVec )
+{
+    int nray = ( int )origVec.size();
+    numCrossVec.assign( nray, 0 );
+
+    if ( m_NodeVec.empty() || nray == 0 )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
-        }
         return;
     }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
+    //==== Neighboring Rays Visit Mostly The Same Nodes, So Group Them Into Packets ====//
+    vector< int > orderVec;
+    SortRayOrigins( origVec, dir, orderVec );
 
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    //==== A Huge Finite Inverse Keeps The Slab Test Branch Free For Axis Parallel Rays ====//
+    double inv_dir[3];
+    for ( int k = 0 ; k < 3 ; k++ )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        inv_dir[k] = ( dir[k] != 0.0 ) ? 1.0 / dir[k] : 1.0e300;
+    }
+
+    const int npack = ( nray + BVH_PACKET_SIZE - 1 ) / BVH_PACKET_SIZE;
+
+    #pragma omp parallel
+    {
+        //==== Scratch Buffers Reused By Every Packet A Thread Handles ====//
+        vector< pair< int, unsigned int > > stack;
+        vector< double > hitVec[BVH_PACKET_SIZE];
 
-        if ( iFlag && tparm > 0.0 )
+        #pragma omp for schedule( dynamic, 16 )
+        for ( int p = 0 ; p < npack ; p++ )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            int first = p * BVH_PACKET_SIZE;
+            int nr = std::min( ( int )BVH_PACKET_SIZE, nray - first );
+
+            double orig[3][BVH_PACKET_SIZE];
+            for ( int r = 0 ; r < nr ; r++ )
+            {
+                hitVec[r].clear();
+                const vec3d & o = origVec[orderVec[first + r]];
+                orig[0][r] = o.x();
+                orig[1][r] = o.y();
+                orig[2][r] = o.z();
+            }
+
+            //==== Each Stack Entry Carries The Rays Still Alive At That Node ====//
+            stack.clear();
+            stack.push_back( pair< int, unsigned int >( 0, ( 1u << nr ) - 1 ) );
+
+            while ( !stack.empty() )
             {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                const TBvhNode & n = m_NodeVec[stack.back().first];
+                unsigned int in_mask = stack.back().second;
+                stack.pop_back();
+
+                //==== Slab Test Padded By The Same Tolerance As intersectRayAABB ====//
+                vec3d bmin = n.m_Box.GetMin() - vec3d( 0.00001, 0.00001, 0.00001 );
+                vec3d bmax = n.m_Box.GetMax() + vec3d( 0.00001, 0.00001, 0.00001 );
+                unsigned int mask = 0;
+                for ( int r = 0 ; r < nr ; r++ )
                 {
-                    dupFlag = 1;
-                    break;
+                    double tmin = 0.0;
+                    double tmax = 1.0e300;
+                    for ( int k = 0 ; k < 3 ; k++ )
+                    {
+                        double t0 = ( bmin[k] - orig[k][r] ) * inv_dir[k];
+                        double t1 = ( bmax[k] - orig[k][r] ) * inv_dir[k];
+                        tmin = std::max( tmin, std::min( t0, t1 ) );
+                        tmax = std::min( tmax, std::max( t0, t1 ) );
+                    }
+                    mask |= ( unsigned int )( tmin <= tmax ) << r;
+                }
+                mask &= in_mask;
+                if ( !mask )
+                {
+                    continue;
+                }
+
+                if ( n.m_Count == 0 )
+                {
+                    stack.push_back( pair< int, unsigned int >( n.m_Start + 1, mask ) );
+                    stack.push_back( pair< int, unsigned int >( n.m_Start, mask ) );
+                    continue;
+                }
+
+                //==== Moller-Trumbore With The Direction Dependent Terms Shared By The Packet ====//
+                for ( int i = n.m_Start ; i < n.m_Start + n.m_Count ; i++ )
+                {
+                    TTri* tri = m_TriVec[i];
+                    const double* v0 = tri->m_N0->m_Pnt.v;
+                    const double* v1 = tri->m_N1->m_Pnt.v;
+                    const double* v2 = tri->m_N2->m_Pnt.v;
+
+                    double e1[3] = { v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2] };
+                    double e2[3] = { v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2] };
+                    double pv[3] = { dir[1] * e2[2] - dir[2] * e2[1],
+                                     dir[2] * e2[0] - dir[0] * e2[2],
+                                     dir[0] * e2[1] - dir[1] * e2[0] };
+                    double det = e1[0] * pv[0] + e1[1] * pv[1] + e1[2] * pv[2];
+                    if ( det > -0.000001 && det < 0.000001 )
+                    {
+                        continue;
+                    }
+                    double inv_det = 1.0 / det;
+
+                    for ( int r = 0 ; r < nr ; r++ )
+                    {
+                        if ( !( mask & ( 1u << r ) ) )
+                        {
+                            continue;
+                        }
+                        double tv[3] = { orig[0][r] - v0[0], orig[1][r] - v0[1], orig[2][r] - v0[2] };
+                        double u = ( tv[0] * pv[0] + tv[1] * pv[1] + tv[2] * pv[2] ) * inv_det;
+                        if ( u < 0.0 || u > 1.0 )
+                        {
+                            continue;
+                        }
+                        double qv[3] = { tv[1] * e1[2] - tv[2] * e1[1],
+                                         tv[2] * e1[0] - tv[0] * e1[2],
+                                         tv[0] * e1[1] - tv[1] * e1[0] };
+                        double v = ( dir[0] * qv[0] + dir[1] * qv[1] + dir[2] * qv[2] ) * inv_det;
+                        if ( v < 0.0 || u + v > 1.0 )
+                        {
+                            continue;
+                        }
+                        double t = ( e2[0] * qv[0] + e2[1] * qv[1] + e2[2] * qv[2] ) * inv_det;
+                        if ( t > 0.0 )
+                        {
+                            hitVec[r].push_back( t );
+                        }
+                    }
                 }
             }
 
-            if ( !dupFlag )
+            //==== Hits On Shared Edges and Vertices Collapse To One Crossing ====//
+            for ( int r = 0 ; r < nr ; r++ )
             {
-                tParmVec.push_back( tparm );
+                vector< double > & hits = hitVec[r];
+                std::sort( hits.begin(), hits.end() );
+                int cnt = 0;
+                for ( int j = 0 ; j < ( int )hits.size() ; j++ )
+                {
+                    if ( j == 0 || hits[j] - hits[j - 1] >= 0.0000001 )
+                    {
+                        cnt++;
+                    }
+                }
+                numCrossVec[orderVec[first + r]] = cnt;
             }
         }
     }
-
 }
 
 void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
 {
-    int i, t;
-
-    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
+    if ( m_NodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    //==== Any Node The Segment Crosses Overlaps Its Bounding Box ====//
+    BndBox seg_box;
+    seg_box.Update( p0 );
+    seg_box.Update( p1 );
+
+    double tparm, uparm, vparm;
+    vec3d p10 = p1 - p0;
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & n = m_NodeVec[stack.back()];
+        stack.pop_back();
+
+        if ( !Compare( n.m_Box, seg_box ) )
         {
-            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
+            continue;
         }
-        return;
-    }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
-    {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
+        if ( n.m_Count == 0 )
         {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
+            stack.push_back( n.m_Start + 1 );
+            stack.push_back( n.m_Start );
+            continue;
         }
-    }
 
+        //==== Check All Tris In Leaf ====//
+        for ( int t = n.m_Start ; t < n.m_Start + n.m_Count ; t++ )
+        {
+            TTri* tri = m_TriVec[t];
+            vec3d n0pnt  = tri->m_N0->m_Pnt;
+            vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
+            vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
+            if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
+                                    p0, p10, uparm, vparm, tparm ) )
+            {
+                vec3d pnt = p0 + p10 * tparm;
+                ipntVec.push_back( pnt );
+            }
+        }
+    }
 }
 
 //===============================================//
@@ -3629,10 +4386,9 @@ void TMesh::StressTest()
         vec3d e0;
         vec3d e1;
         int coplanarFlag;
-        int iflag = tri_tri_intersect_with_isectline(
-                        t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                        t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                        &coplanarFlag, e0.v, e1.v );
+        int iflag = tri_tri_isect_exact( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                         t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt,
+                                         coplanarFlag, e0, e1 );
 
         if ( iflag && !coplanarFlag )
         {
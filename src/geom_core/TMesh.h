@@ -104,6 +104,38 @@ public:
     double m_Iyz;
 };
 
+//==== Running Weight, Volume and Moments Accumulated About A Fixed Reference Point ====//
+class MassPropSum
+{
+public:
+    MassPropSum( const vec3d & ref = vec3d() );
+
+    void Add( double weight, double vol, const vec3d & cg,
+              double ixx, double iyy, double izz, double ixy, double ixz, double iyz );
+    void Add( const MassPropSum & sum );
+
+    //==== Accumulate A Tetra Of Density den Directly - No TetraMassProp Built ====//
+    void AddTetra( double den, const vec3d & p0, const vec3d & p1, const vec3d & p2, const vec3d & p3 );
+
+    double GetWeight() const            { return Total( WEIGHT ); }
+    double GetVol() const               { return Total( VOL ); }
+    vec3d GetCG() const;
+    void GetInertia( double & ixx, double & iyy, double & izz, double & ixy, double & ixz, double & iyz ) const;
+
+    vec3d m_Ref;
+
+protected:
+
+    enum { WEIGHT, VOL, MX, MY, MZ, IXX, IYY, IZZ, IXY, IXZ, IYZ, NUM_TERMS };
+
+    //==== Neumaier Compensated Summation ====//
+    void Accum( int i, double val );
+    double Total( int i ) const         { return m_Sum[i] + m_Comp[i]; }
+
+    double m_Sum[NUM_TERMS];            // Moments Are Weight * ( CG - Ref ), Second Moments About m_Ref
+    double m_Comp[NUM_TERMS];           // Lost Low Order Bits Of m_Sum
+};
+
 //===========================================================================================================//
 //================================================ DegenGeom ================================================//
 //===========================================================================================================//
@@ -344,6 +376,34 @@ private:
 
 };
 
+//==== Intersection Edge Waiting To Be Added To Its Tri ====//
+typedef pair< TTri*, TEdge* > TTriISectEdge;
+
+//==== Intersection Segments Of One Mesh Pair, Stored By Tri Index For Replay ====//
+struct TMeshPairISect
+{
+    vector< int > m_TriIndVec;      // Tri index in the first mesh, or ( -1 - index ) in the second
+    vector< vec3d > m_Pnt0Vec;
+    vector< vec3d > m_Pnt1Vec;
+};
+
+//==== Pair Intersections Keyed By The Content Hashes Of Both Meshes ====//
+struct TMeshISectCache
+{
+    map< unsigned long long, vector< double > > m_MeshKeyMap;      // Full content behind each hash, compared on a hit
+    map< pair< unsigned long long, unsigned long long >, TMeshPairISect > m_PairMap;
+};
+
+//==== Flattened BVH Node - Interior Nodes Store Two Adjacent Children ====//
+struct TBvhNode
+{
+    TBvhNode() : m_Start( 0 ), m_Count( 0 )     {}
+
+    BndBox m_Box;
+    int m_Start;                // Leaf: First Tri in m_TriVec, Interior: Left Child Index
+    int m_Count;                // Number of Tris, Zero For Interior Nodes
+};
+
 class TBndBox
 {
 public:
@@ -353,21 +413,55 @@ public:
     virtual void Reset();
 
     BndBox m_Box;
-    vector< TTri* > m_TriVec;
+    vector< TTri* > m_TriVec;   // Reordered By SplitBox So Leaves Are Contiguous
 
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
+    vector< TBvhNode > m_NodeVec;   // Root At Index Zero
+
+    enum { BVH_NUM_BINS = 16, BVH_LEAF_MIN = 4, BVH_LEAF_MAX = 8, BVH_PACKET_SIZE = 8 };
 
     void SplitBox();
+    void Refit();
     void AddTri( TTri* t );
-    virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
+    virtual void Intersect( TBndBox* iBox, bool UWFlag = false, vector< TTriISectEdge >* isect_buf = NULL );
     virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
     virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
-    virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
+    virtual void RayCastCount( const vector< vec3d > & origVec, const vec3d & dir, vector< int > & numCrossVec );
 
     virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
     virtual bool CheckIntersect( TBndBox* iBox );
     virtual double MinDistance( TBndBox* iBox, double curr_min_dist );
 
+protected:
+
+    void IntersectLeaves( const TBvhNode & n0, TBndBox* iBox, const TBvhNode & n1, bool UWFlag, vector< TTriISectEdge >* isect_buf );
+
+};
+
+//==== Shared Vertex Index Of Leaf Tris For Export And Results ====//
+// A read-only snapshot built from the TTri graph: coincident corners are merged once so the
+// file writers, mesh results and point cloud export index flat arrays.  This is the only user
+// of indexed storage - TMesh itself still keeps three TNodes per TTri, and CompGeom, MassProp
+// and the XML encoder still walk those pointer tris.
+class TMeshExportIndex
+{
+public:
+    TMeshExportIndex()                  {}
+
+    void Clear();
+    void Build( const vector< TTri* > & triVec, double tol );
+
+    int NumPnts() const                 { return ( int )m_PntVec.size(); }
+    int NumTris() const                 { return ( int )m_TriVec.size() / 3; }
+
+    int GetTriNode( int t, int k ) const { return m_TriVec[ 3 * t + k ]; }
+    const vec3d & GetPnt( int t, int k ) const
+    {
+        return m_PntVec[ m_TriVec[ 3 * t + k ] ];
+    }
+
+    vector< vec3d > m_PntVec;
+    vector< int > m_TriVec;             // Three Node Indices Per Tri
+    vector< int > m_TagVec;             // SubSurfaceMgr Tag Per Tri
 };
 
 class Geom;
@@ -417,17 +511,19 @@ public:
     void LoadGeomAttributes( Geom* geomPtr );
     int  RemoveDegenerate();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    void Intersect( TMesh* tm, vector< TTriISectEdge > & isect_buf );
+    void ContentKey( vector< double > & key );
+    static unsigned long long ContentHash( const vector< double > & key );
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
+    void LoadIntExtQueries( vector< TTri* > & triVec, vector< vec3d > & origVec );
     void DeterIntExt( vector< TMesh* >& meshVec );
-    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
     void MassDeterIntExt( vector< TMesh* >& meshVec );
-    void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
     void WaveDeterIntExt( vector< TMesh* >& meshVec );
-    void WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
 
     void LoadBndBox();
+    void RefitBndBox();
 
     virtual double ComputeTheoArea();
     virtual double ComputeWetArea();
@@ -563,6 +563,7 @@ void VarPresetMgrSingleton::SettingChange( int set_index )
     {
         vector <string> p_IDs = m_PresetVec[ group_index ].GetParmIDs();
         vector <double> p_val = m_PresetVec[ group_index ].GetParmVals( set_index );
+        ParmMgr.BeginTransaction();
         for ( int j = 0; j < p_IDs.size(); j++ )
         {
             // Change Values in ParmScreen
@@ -572,7 +573,8 @@ void VarPresetMgrSingleton::SettingChange( int set_index )
         // Change Current Set Name in Preset
         m_PresetVec[ group_index ].SetCurSetName( m_CurSettingText );
 
-        VehicleMgr.GetVehicle()->Update();
+        // Propagate links and update once.
+        ParmMgr.CommitTransaction();
 
         m_PrevDeleteFlag = false;
     }
@@ -300,6 +300,9 @@ void Vehicle::Wype()
     // Remove references to this set up in Init()
     LinkMgr.UnRegisterContainer( this->GetID() );
 
+    // Drop any open parm transaction, its parms are about to be freed
+    ParmMgr.ResetTransaction();
+
     // Public member variables
     m_IxxIyyIzz = vec3d();
     m_IxyIxzIyz = vec3d();
@@ -365,10 +368,12 @@ void Vehicle::SetupPaths()
     m_VSPAEROCmd = string( "vspaero.exe" );
     m_VIEWERCmd = string( "vspviewer.exe" );
     m_SLICERCmd = string( "vspslicer.exe" );
+    m_VSPScriptCmd = string( "vspscript.exe" );
 #else
     m_VSPAEROCmd = string( "vspaero" );
     m_VIEWERCmd = string( "vspviewer" );
     m_SLICERCmd = string( "vspslicer" );
+    m_VSPScriptCmd = string( "vspscript" );
 #endif
 
     if( !CheckForFile( m_ExePath, m_VSPAEROCmd ) )
@@ -383,6 +388,10 @@ void Vehicle::SetupPaths()
     {
         printf( "VSPAERO slicer not found.\n" );
     }
+    if ( !CheckForFile( m_ExePath, m_VSPScriptCmd ) )
+    {
+        printf( "VSPScript not found.\n" );
+    }
 
     m_CustomScriptDirs.push_back( string( "./CustomScripts/" ) );
     m_CustomScriptDirs.push_back( m_HomePath + string( "/CustomScripts/" ) );
@@ -432,16 +441,319 @@ void Vehicle::UnDo()
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
+    //==== Outputs Written During A Pass Can Dirty Geoms Through Links - Repeat Until Stable ====//
+    std::set< string > changed_id_set;
+    FindChangedGeoms( fullupdate, changed_id_set );
+
+    for ( int pass = 0 ; pass < MAX_UPDATE_PASSES && !changed_id_set.empty() ; pass++ )
+    {
+        UpdateChangedGeoms( fullupdate, changed_id_set );
+
+        changed_id_set.clear();
+        FindChangedGeoms( fullupdate, changed_id_set );
+    }
+
+    MeasureMgr.Update();
+}
+
+//==== Flagged Geoms And Geoms Owning Parms Changed Since Their Last Update ====//
+// A partial update leaves the full-only steps owed, so the next full update redoes those geoms.
+void Vehicle::FindChangedGeoms( bool fullupdate, std::set< string > & changed_id_set )
+{
+    int min_cnt = INT_MAX;
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        Geom* g_ptr = m_GeomStoreVec[i];
+        if ( g_ptr )
+        {
+            if ( g_ptr->GetLateUpdateFlag() || ( fullupdate && g_ptr->GetFullUpdatePending() ) )
+            {
+                changed_id_set.insert( g_ptr->GetID() );
+            }
+            if ( g_ptr->GetUpdateCnt() < min_cnt )
+            {
+                min_cnt = g_ptr->GetUpdateCnt();
+            }
+        }
+    }
+
+    vector< Parm* > changed_parm_vec;
+    ParmMgr.FindChangedParms( min_cnt, changed_parm_vec );
+    for ( int i = 0 ; i < ( int )changed_parm_vec.size() ; i++ )
+    {
+        Geom* g_ptr = FindParmOwnerGeom( changed_parm_vec[i]->GetContainer() );
+        if ( g_ptr && changed_parm_vec[i]->GetChangeCnt() > g_ptr->GetUpdateCnt() )
+        {
+            changed_id_set.insert( g_ptr->GetID() );
+        }
+    }
+}
+
+//==== Update One Pass Over The Changed Geoms ====//
+void Vehicle::UpdateChangedGeoms( bool fullupdate, const std::set< string > & changed_id_set )
+{
+    //==== Subtrees Built Only From Self Contained Geoms Do Not Read Each Other ====//
+    vector< int > par_ind_vec;
+    map< string, int > top_ind_map;
     for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
     {
         Geom* g_ptr = FindGeom( m_TopGeom[i] );
-        if ( g_ptr )
+        if ( !g_ptr )
+        {
+            continue;
+        }
+
+        vector< string > id_vec;
+        g_ptr->LoadIDAndChildren( id_vec );
+
+        bool changed = false;
+        bool safe = true;
+        for ( int j = 0 ; j < ( int )id_vec.size() ; j++ )
+        {
+            top_ind_map[ id_vec[j] ] = i;
+            if ( changed_id_set.count( id_vec[j] ) )
+            {
+                changed = true;
+            }
+            if ( !ParallelUpdateSafe( FindGeom( id_vec[j] ) ) )
+            {
+                safe = false;
+            }
+        }
+
+        if ( changed && safe )
         {
-            g_ptr->Update( fullupdate );
+            par_ind_vec.push_back( i );
         }
     }
 
-    MeasureMgr.Update();
+    //==== Link Targets Of Another Subtree Must Wait For Its Sets To Propagate ====//
+    std::set< int > target_set;
+    if ( par_ind_vec.size() > 1 )
+    {
+        FindCrossLinkTargets( top_ind_map, target_set );
+    }
+
+    vector< Geom* > par_top_vec;
+    for ( int i = 0 ; i < ( int )par_ind_vec.size() ; i++ )
+    {
+        if ( !target_set.count( par_ind_vec[i] ) )
+        {
+            par_top_vec.push_back( FindGeom( m_TopGeom[ par_ind_vec[i] ] ) );
+        }
+    }
+
+    if ( par_top_vec.size() > 1 )
+    {
+        UpdateSubtreesConcurrently( par_top_vec, fullupdate, changed_id_set );
+    }
+    else
+    {
+        par_top_vec.clear();
+    }
+
+    //==== Unchanged Subtrees Are Skipped - Their Update Would Reproduce The Same Result ====//
+    for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
+    {
+        Geom* g_ptr = FindGeom( m_TopGeom[i] );
+        if ( g_ptr && !vector_contains_val( par_top_vec, g_ptr ) )
+        {
+            g_ptr->UpdateChanged( fullupdate, changed_id_set );
+        }
+    }
+}
+
+//==== Top Geom Index Of The Subtree Whose Update Consumes A Parm ====//
+int Vehicle::FindParmSubtree( const string & parm_id, const map< string, int > & top_ind_map )
+{
+    Parm* p = ParmMgr.FindParm( parm_id );
+    if ( !p )
+    {
+        return -1;
+    }
+
+    Geom* g_ptr = FindParmOwnerGeom( p->GetContainer() );
+    if ( !g_ptr )
+    {
+        return -1;
+    }
+
+    map< string, int >::const_iterator it = top_ind_map.find( g_ptr->GetID() );
+    if ( it == top_ind_map.end() )
+    {
+        return -1;
+    }
+    return it->second;
+}
+
+//==== Subtrees Holding A Link Or Adv Link Output Driven From Another Subtree ====//
+void Vehicle::FindCrossLinkTargets( const map< string, int > & top_ind_map, std::set< int > & target_set )
+{
+    vector< pair< string, string > > drive_vec;
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* link = LinkMgr.GetLink( i );
+        if ( link )
+        {
+            drive_vec.push_back( make_pair( link->GetParmA(), link->GetParmB() ) );
+        }
+    }
+
+    vector< AdvLink* > adv_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_vec.size() ; i++ )
+    {
+        vector< VarDef > in_vec = adv_vec[i]->GetInputVars();
+        vector< VarDef > out_vec = adv_vec[i]->GetOutputVars();
+        for ( int j = 0 ; j < ( int )in_vec.size() ; j++ )
+        {
+            for ( int k = 0 ; k < ( int )out_vec.size() ; k++ )
+            {
+                drive_vec.push_back( make_pair( in_vec[j].m_ParmID, out_vec[k].m_ParmID ) );
+            }
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )drive_vec.size() ; i++ )
+    {
+        int from = FindParmSubtree( drive_vec[i].first, top_ind_map );
+        int to = FindParmSubtree( drive_vec[i].second, top_ind_map );
+        if ( from >= 0 && to >= 0 && from != to )
+        {
+            target_set.insert( to );
+        }
+    }
+}
+
+//==== Geoms Whose Update Only Touches Their Own Subtree And Creates No Parms ====//
+bool Vehicle::ParallelUpdateSafe( Geom* g_ptr )
+{
+    if ( !g_ptr || !g_ptr->GetFeaStructVec().empty() )
+    {
+        return false;
+    }
+
+    switch ( g_ptr->GetType().m_Type )
+    {
+    case POD_GEOM_TYPE:
+    case FUSELAGE_GEOM_TYPE:
+    case MS_WING_GEOM_TYPE:
+    case BLANK_GEOM_TYPE:
+    case STACK_GEOM_TYPE:
+    case PROP_GEOM_TYPE:
+    case ELLIPSOID_GEOM_TYPE:
+    case BOR_GEOM_TYPE:
+        return true;
+    }
+
+    return false;
+}
+
+//==== Update Independent Subtrees Concurrently ====//
+// Parm sets made while updating are recorded per subtree instead of counted and propagated, then
+// merged in subtree order so change counts and link updates do not depend on thread timing.
+void Vehicle::UpdateSubtreesConcurrently( const vector< Geom* > & top_vec, bool fullupdate, const std::set< string > & changed_id_set )
+{
+    vector< Geom* > geom_vec;
+    for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+    {
+        vector< string > id_vec;
+        top_vec[i]->LoadIDAndChildren( id_vec );
+        for ( int j = 0 ; j < ( int )id_vec.size() ; j++ )
+        {
+            geom_vec.push_back( FindGeom( id_vec[j] ) );
+        }
+    }
+
+    vector< int > tess_num_vec( geom_vec.size() );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        tess_num_vec[i] = geom_vec[i]->GetTessSerialNum();
+    }
+
+    vector< vector< Parm* > > deferred_vecs( top_vec.size() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+    {
+        ParmMgr.BeginDeferredSets( &deferred_vecs[i] );
+        top_vec[i]->UpdateChanged( fullupdate, changed_id_set );
+        ParmMgr.EndDeferredSets();
+    }
+
+    //==== Stamp Deferred Sets In Subtree Then Set Order ====//
+    for ( int i = 0 ; i < ( int )deferred_vecs.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )deferred_vecs[i].size() ; j++ )
+        {
+            deferred_vecs[i][j]->StampChangeCnt();
+        }
+    }
+
+    //==== Geoms That Ran Are Current Through Their Own Sets ====//
+    int cnt = ParmMgr.GetLatestChangeCnt();
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i]->GetTessSerialNum() != tess_num_vec[i] )
+        {
+            geom_vec[i]->SetUpdateCnt( cnt );
+        }
+    }
+
+    //==== Then Propagate Links In The Same Order ====//
+    for ( int i = 0 ; i < ( int )deferred_vecs.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )deferred_vecs[i].size() ; j++ )
+        {
+            deferred_vecs[i][j]->NotifySet();
+        }
+    }
+}
+
+//==== Rebuild Stale Draw Objects - Each Only Reads Its Own Geom, So Tesselate Concurrently ====//
+void Vehicle::UpdateStaleDrawObjs( const vector< Geom* > & geom_vec )
+{
+    vector< Geom* > stale_vec;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i] && !geom_vec[i]->GetDrawObjValid() )
+        {
+            stale_vec.push_back( geom_vec[i] );
+        }
+    }
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )stale_vec.size() ; i++ )
+    {
+        stale_vec[i]->ValidateDrawObj();
+    }
+}
+
+//==== Find Geom Whose Update Consumes Parms Of This Container ====//
+Geom* Vehicle::FindParmOwnerGeom( ParmContainer* pc )
+{
+    while ( pc )
+    {
+        Geom* g_ptr = dynamic_cast< Geom* >( pc );
+        if ( g_ptr )
+        {
+            return g_ptr;
+        }
+
+        FeaStructure* fea_struct = dynamic_cast< FeaStructure* >( pc );
+        if ( fea_struct )
+        {
+            return FindGeom( fea_struct->GetParentGeomID() );
+        }
+
+        FeaPart* fea_part = dynamic_cast< FeaPart* >( pc );
+        if ( fea_part )
+        {
+            return FindGeom( fea_part->GetParentGeomID() );
+        }
+
+        pc = pc->GetParentContainerPtr();
+    }
+    return NULL;
 }
 
 void Vehicle::UpdateGeom( const string &geom_id )
@@ -1154,6 +1466,7 @@ vector< DrawObj* > Vehicle::GetDrawObjs()
 
     //==== Traverse All Active Displayed Geom and Load DrawObjs ====//
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec( false ) );
+    UpdateStaleDrawObjs( geom_vec );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
         geom_vec[i]->LoadDrawObjs( draw_obj_vec );
@@ -3713,7 +4026,7 @@ string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool
     return id;
 }
 
-string Vehicle::PSlice( int set, int numSlices, vec3d axis, bool autoBoundsFlag, double start, double end )
+string Vehicle::PSlice( int set, int numSlices, vec3d axis, bool autoBoundsFlag, double start, double end, bool directFlag )
 {
 
     string id = AddMeshGeom( set );
@@ -3732,7 +4045,7 @@ string Vehicle::PSlice( int set, int numSlices, vec3d axis, bool autoBoundsFlag,
 
     if ( mesh_ptr->m_TMeshVec.size() )
     {
-        mesh_ptr->AreaSlice( numSlices, axis, autoBoundsFlag, start, end );
+        mesh_ptr->AreaSlice( numSlices, axis, autoBoundsFlag, start, end, directFlag );
     }
     else
     {
@@ -3744,9 +4057,10 @@ string Vehicle::PSlice( int set, int numSlices, vec3d axis, bool autoBoundsFlag,
     return id;
 }
 
-string Vehicle::PSliceAndFlatten( int set, int numSlices, vec3d axis, bool autoBoundsFlag, double start, double end )
+string Vehicle::PSliceAndFlatten( int set, int numSlices, vec3d axis, bool autoBoundsFlag, double start, double end,
+                                  bool directFlag )
 {
-    string id = PSlice( set, numSlices, axis, autoBoundsFlag, start, end );
+    string id = PSlice( set, numSlices, axis, autoBoundsFlag, start, end, directFlag );
     Geom* geom = FindGeom( id );
     if ( !geom )
     {
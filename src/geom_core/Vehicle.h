@@ -73,6 +73,7 @@ public:
     void Update( bool fullupdate = true );
     void UpdateGeom( const string &geom_id );
     void ForceUpdate();
+    void UpdateStaleDrawObjs( const vector< Geom* > & geom_vec );
     void UpdateGui();
     void RunScript( const string & file_name, const string & function_name = "void main()" );
 
@@ -148,6 +149,8 @@ public:
 
     enum { REORDER_MOVE_UP, REORDER_MOVE_DOWN, REORDER_MOVE_TOP, REORDER_MOVE_BOTTOM };
 
+    enum { MAX_UPDATE_PASSES = 8 };     // Bounds link cycles whose outputs never settle
+
     bool ExistMesh( int set );
 
     vector < string > GetPtCloudGeoms();
@@ -165,6 +168,7 @@ public:
     string GetVSPAEROCmd()                                  { return m_VSPAEROCmd; }
     string GetVIEWERCmd()                                   { return m_VIEWERCmd; }
     string GetSLICERCmd()                                   { return m_SLICERCmd; }
+    string GetVSPScriptCmd()                                { return m_VSPScriptCmd; }
 
     //==== Get Script Dir to Write Scripts ====//
     string GetWriteScriptDir()                              { return m_CustomScriptDirs[0]; }
@@ -241,8 +245,10 @@ public:
     string CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag = 1 );
     string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true );
     string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true );
-    string PSlice( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
-    string PSliceAndFlatten( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
+    string PSlice( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0,
+                   bool directFlag = false );
+    string PSliceAndFlatten( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0,
+                             bool directFlag = false );
 
     //==== Degenerate Geometry ====//
     void CreateDegenGeom( int set );
@@ -276,6 +282,11 @@ public:
         return &m_ClippingMgr;
     }
 
+    TMeshISectCache* GetCompGeomISectCachePtr()
+    {
+        return &m_CompGeomISectCache;
+    }
+
     SnapTo* GetSnapToPtr()
     {
         return &m_SnapTo;
@@ -396,6 +407,16 @@ protected:
 
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
+    Geom* FindParmOwnerGeom( ParmContainer* pc );
+
+    void FindChangedGeoms( bool fullupdate, std::set< string > & changed_id_set );
+    void UpdateChangedGeoms( bool fullupdate, const std::set< string > & changed_id_set );
+
+    bool ParallelUpdateSafe( Geom* g_ptr );
+    int FindParmSubtree( const string & parm_id, const map< string, int > & top_ind_map );
+    void FindCrossLinkTargets( const map< string, int > & top_ind_map, std::set< int > & target_set );
+    void UpdateSubtreesConcurrently( const vector< Geom* > & top_vec, bool fullupdate, const std::set< string > & changed_id_set );
+
     //==== Primary file name ====//
     string m_VSP3FileName;
 
@@ -410,6 +431,7 @@ protected:
     string m_VSPAEROCmd;
     string m_VIEWERCmd;
     string m_SLICERCmd;
+    string m_VSPScriptCmd;
     vector< string > m_CustomScriptDirs;
 
     IntersectSettings m_ISectSettings;
@@ -420,6 +442,9 @@ protected:
     ClippingMgr m_ClippingMgr;
     SnapTo m_SnapTo;
 
+    //==== Mesh Pair Intersections From The Last CompGeom ====//
+    TMeshISectCache m_CompGeomISectCache;
+
     VehicleGuiDraw m_VGuiDraw;
 
     // Class to handle group transformations
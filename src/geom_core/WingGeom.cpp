@@ -1657,25 +1657,25 @@ void WingGeom::UpdateSurf()
 {
     //==== Check If Total Span/Chord/Area Has Changed ====//
     bool total_change_flag = false;
-    if ( UpdatedParm( m_TotalSpan.GetID() ) )
+    if ( UpdatedParm( m_TotalSpan.GetHandle() ) )
     {
         UpdateTotalSpan();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalProjSpan.GetID() ) )
+    if ( UpdatedParm( m_TotalProjSpan.GetHandle() ) )
     {
         UpdateTotalProjSpan();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalChord.GetID() ) )
+    if ( UpdatedParm( m_TotalChord.GetHandle() ) )
     {
         UpdateTotalChord();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalArea.GetID() ) )
+    if ( UpdatedParm( m_TotalArea.GetHandle() ) )
     {
         UpdateTotalArea();
         total_change_flag = true;
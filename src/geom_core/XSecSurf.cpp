@@ -248,6 +248,7 @@ string XSecSurf::InsertXSec( int type, int index )
         {
             m_XSecIDDeque.push_back( xs->GetID() );
         }
+        ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
     }
     return id;
 }
@@ -262,6 +263,7 @@ string XSecSurf::AddXSec( int type )
     {
         id = xs->GetID();
         m_XSecIDDeque.push_back( id );
+        ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
     }
     return id;
 }
@@ -290,6 +292,7 @@ void XSecSurf::CutXSec( int index )
 
     m_SavedXSec = xs->GetID();
     m_XSecIDDeque.erase( m_XSecIDDeque.begin() + index );
+    ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
 }
 
 //==== Copy XSec ====//
@@ -358,6 +361,7 @@ void XSecSurf::PasteXSec( int index )
     vector_remove_val( m_XSecPtrVec, xs );
 
     delete xs;
+    ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
 }
 
 //==== Copy XSec Curve====//
@@ -403,7 +407,7 @@ void XSecSurf::PasteXSecCurve( int index )
     }
 
     xs->SetXSecCurve( duplicate_saved_crv );
-
+    ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
 
 }
 
@@ -432,6 +436,8 @@ void XSecSurf::ChangeXSecShape( int index, int type )
         m_XSecIDDeque.erase( m_XSecIDDeque.begin() + index + 1 );
         vector_remove_val( m_XSecPtrVec, xs );
         delete xs;
+
+        ParmChanged( NULL, Parm::SET );     // XSec List Changed - Flag Parent Geom For Update
     }
 }
 
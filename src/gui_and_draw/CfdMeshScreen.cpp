@@ -171,6 +171,7 @@ void CfdMeshScreen::CreateOutputTab()
 
     m_OutputTabLayout.SetFitWidthFlag( true );
     m_OutputTabLayout.AddButton(m_TaggedMultiSolid, "Tagged Multi Sold STL (Non-Standard)");
+    m_OutputTabLayout.AddButton(m_STLBinary, "Binary STL");
     m_OutputTabLayout.SetFitWidthFlag( false );
     m_OutputTabLayout.ForceNewLine();
     m_OutputTabLayout.AddYGap();
@@ -195,6 +196,11 @@ void CfdMeshScreen::CreateOutputTab()
     m_OutputTabLayout.AddOutput(m_MshOutput);
     m_OutputTabLayout.AddButton(m_SelectMshFile, "...");
     m_OutputTabLayout.ForceNewLine();
+
+    m_OutputTabLayout.SetFitWidthFlag( true );
+    m_OutputTabLayout.AddButton(m_GmshBinary, "Binary Gmsh 4.1 .msh");
+    m_OutputTabLayout.SetFitWidthFlag( false );
+    m_OutputTabLayout.ForceNewLine();
     m_OutputTabLayout.AddYGap();
 
     m_OutputTabLayout.SetFitWidthFlag( true );
@@ -708,11 +714,23 @@ void CfdMeshScreen::UpdateOutputTab()
     //==== Update File Output Flags ====//
     m_StlFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME )->GetID() );
     m_TaggedMultiSolid.Update( m_Vehicle->m_STLMultiSolid.GetID() );
+    m_STLBinary.Update( m_Vehicle->GetCfdSettingsPtr()->m_STLBinaryFlag.GetID() );
+
+    //==== Binary STL Has No Named Solids ====//
+    if ( m_Vehicle->GetCfdSettingsPtr()->m_STLBinaryFlag() )
+    {
+        m_TaggedMultiSolid.Deactivate();
+    }
+    else
+    {
+        m_TaggedMultiSolid.Activate();
+    }
     m_PolyFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME )->GetID() );
     m_TriFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_TRI_FILE_NAME )->GetID() );
     m_FacFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_FACET_FILE_NAME )->GetID() );
     m_ObjFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_OBJ_FILE_NAME )->GetID() );
     m_MshFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_GMSH_FILE_NAME )->GetID() );
+    m_GmshBinary.Update( m_Vehicle->GetCfdSettingsPtr()->m_GmshBinaryFlag.GetID() );
     m_DatFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_DAT_FILE_NAME )->GetID() );
     m_KeyFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_KEY_FILE_NAME )->GetID() );
     m_SrfFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_SRF_FILE_NAME )->GetID() );
@@ -106,11 +106,13 @@ protected:
 
     ToggleButton m_StlFile;
     ToggleButton m_TaggedMultiSolid;
+    ToggleButton m_STLBinary;
     ToggleButton m_PolyFile;
     ToggleButton m_TriFile;
     ToggleButton m_FacFile;
     ToggleButton m_ObjFile;
     ToggleButton m_MshFile;
+    ToggleButton m_GmshBinary;
     ToggleButton m_DatFile;
     ToggleButton m_KeyFile;
     ToggleButton m_SrfFile;
@@ -723,6 +723,7 @@ void ManageGeomScreen::SetSubDrawFlag( bool f )
         if ( geom_vec[i] )
         {
             geom_vec[i]->m_GuiDraw.SetDispSubSurfFlag( f );
+            geom_vec[i]->InvalidateDrawObj();
         }
     }
 }
@@ -738,6 +739,7 @@ void ManageGeomScreen::SetFeatureDrawFlag( bool f )
         if ( geom_vec[i] )
         {
             geom_vec[i]->m_GuiDraw.SetDispFeatureFlag( f );
+            geom_vec[i]->InvalidateDrawObj();
         }
     }
 
@@ -922,6 +924,7 @@ void ManageGeomScreen::UpdateDrawObjs()
     if( m_PickButton.GetFlButton()->value() == 1 )
     {
         vector< Geom* > geom_vec = m_VehiclePtr->FindGeomVec( m_VehiclePtr->GetGeomVec( false ) );
+        m_VehiclePtr->UpdateStaleDrawObjs( geom_vec );
         for( int i = 0; i < ( int )geom_vec.size(); i++ )
         {
             std::vector< DrawObj* > geom_drawobj_vec;
@@ -740,6 +740,7 @@ void ManageMeasureScreen::UpdatePickList()
 
     Vehicle* veh = VehicleMgr.GetVehicle();
     vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec( false ) );
+    veh->UpdateStaleDrawObjs( geom_vec );
 
     m_PickList.clear();
 
@@ -3131,6 +3131,7 @@ void StructScreen::OrientStructure( VSPGraphic::Common::VSPenum type )
 
             curr_geom->m_GuiDraw.SetDrawType( GeomGuiDraw::GEOM_DRAW_SHADE );
             curr_geom->m_GuiDraw.SetDispSubSurfFlag( true );
+            curr_geom->InvalidateDrawObj();
 
             veh->ShowSet( 0 );
             veh->HideAllExcept( curr_struct->GetParentGeomID() );
@@ -1685,6 +1685,7 @@ void VSPAEROScreen::DisplayDegenCamberPreview()
 
             geom_vec[i]->m_GuiDraw.SetDrawType( GeomGuiDraw::GEOM_DRAW_SHADE );
             geom_vec[i]->m_GuiDraw.SetDispSubSurfFlag( true );
+            geom_vec[i]->InvalidateDrawObj();
             geom_vec[i]->SetSetFlag( vsp::SET_SHOWN, true );
             geom_vec[i]->SetSetFlag( vsp::SET_NOT_SHOWN, false );
         }
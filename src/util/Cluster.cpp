@@ -102,6 +102,7 @@ double asinhc( const double &y )
 {
     static double lasty = -1.0; // Negative argument impossible
     static double lastx = 0;
+    #pragma omp threadprivate( lasty, lastx )   // Surfaces are built and tesselated concurrently
 
     if ( y == lasty )
     {
@@ -189,6 +190,7 @@ double asinc( const double &y )
 {
     static double lasty = -1.0; // Negative argument impossible
     static double lastx = 0;
+    #pragma omp threadprivate( lasty, lastx )   // Surfaces are built and tesselated concurrently
 
     if ( y == lasty )
     {
@@ -6,6 +6,9 @@
 #include "FileUtil.h"
 #include "tinydir.h"
 
+#include <algorithm>
+#include <cstdarg>
+
 #ifdef __APPLE__
 #include <mach-o/dyld.h>    /* _NSGetExecutablePath */
 #endif
@@ -17,6 +20,7 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <pwd.h>
+#include <sys/stat.h>
 #endif
 
 
@@ -48,6 +52,7 @@ vector< string > ScanFolder( const char* dir_path )
         }
         tinydir_next( &dir );
     }
+    tinydir_close( &dir );
     return file_vec;
 
 }
@@ -305,3 +310,123 @@ string GetFilename( const string &pathfile )
     return fileParts.back();
 
 }
+
+//==== Open File With A Large Output Buffer ====//
+//==== New Directory Under The System Temp Dir - Named By Process And Counter So Runs Never Share ====//
+string MakeTempDir( const string & prefix )
+{
+    static int s_TempDirCnt = 0;
+
+#ifdef WIN32
+    char tmp_path[MAX_PATH + 1];
+    DWORD len = GetTempPath( MAX_PATH + 1, tmp_path );
+    string tmp_dir = ( len > 0 && len <= MAX_PATH ) ? string( tmp_path ) : string( ".\\" );
+    unsigned long pid = GetCurrentProcessId();
+#else
+    char * tmp_env = getenv( "TMPDIR" );
+    string tmp_dir = tmp_env ? string( tmp_env ) : string( "/tmp" );
+    if ( tmp_dir.empty() || tmp_dir[ tmp_dir.size() - 1 ] != '/' )
+    {
+        tmp_dir += "/";
+    }
+    unsigned long pid = getpid();
+#endif
+
+    for ( int i = 0 ; i < 1000 ; i++ )
+    {
+        char name[64];
+        snprintf( name, sizeof( name ), "_%lu_%d", pid, s_TempDirCnt++ );
+        string dir = tmp_dir + prefix + name;
+
+#ifdef WIN32
+        if ( CreateDirectory( dir.c_str(), NULL ) )
+        {
+            return dir + "\\";
+        }
+#else
+        if ( mkdir( dir.c_str(), 0700 ) == 0 )
+        {
+            return dir + "/";
+        }
+#endif
+    }
+    return string();
+}
+
+//==== Remove A Directory Made By MakeTempDir And The Files In It ====//
+void RemoveDir( const string & dir )
+{
+    if ( dir.empty() )
+    {
+        return;
+    }
+
+    vector< string > file_vec = ScanFolder( dir.c_str() );
+    for ( int i = 0 ; i < ( int )file_vec.size() ; i++ )
+    {
+        remove( ( dir + file_vec[i] ).c_str() );
+    }
+
+#ifdef WIN32
+    RemoveDirectory( dir.c_str() );
+#else
+    rmdir( dir.c_str() );
+#endif
+}
+
+FILE* OpenBufferedFile( const string & filename, const char* mode )
+{
+    FILE* fp = fopen( filename.c_str(), mode );
+    if ( fp )
+    {
+        setvbuf( fp, NULL, _IOFBF, 1 << 20 );
+    }
+    return fp;
+}
+
+//==== Format Rounds Of Blocks In Parallel So Memory Stays Bounded, Write Each Round In Order ====//
+void TextRecordWriter::Write( FILE* fp, int num_rec )
+{
+    const int blk_size = 4096;
+    const int round_size = 64;
+
+    int nblk = ( num_rec + blk_size - 1 ) / blk_size;
+
+    vector< string > blk_vec( std::min( nblk, round_size ) );
+    for ( int b0 = 0 ; b0 < nblk ; b0 += round_size )
+    {
+        int nround = std::min( round_size, nblk - b0 );
+
+        #pragma omp parallel for schedule( dynamic )
+        for ( int b = 0 ; b < nround ; b++ )
+        {
+            blk_vec[b].clear();
+            int istart = ( b0 + b ) * blk_size;
+            int iend = std::min( num_rec, istart + blk_size );
+            for ( int i = istart ; i < iend ; i++ )
+            {
+                FormatRecord( i, blk_vec[b] );
+            }
+        }
+
+        for ( int b = 0 ; b < nround ; b++ )
+        {
+            fwrite( blk_vec[b].data(), sizeof( char ), blk_vec[b].size(), fp );
+        }
+    }
+}
+
+void TextRecordWriter::Append( string & out, const char* fmt, ... )
+{
+    char str[512];
+
+    va_list args;
+    va_start( args, fmt );
+    int len = vsnprintf( str, sizeof( str ), fmt, args );
+    va_end( args );
+
+    if ( len > 0 )
+    {
+        out.append( str, std::min( len, ( int )sizeof( str ) - 1 ) );
+    }
+}
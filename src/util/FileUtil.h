@@ -6,6 +6,7 @@
 #if !defined(FILE_UTIL__INCLUDED_)
 #define FILE_UTIL__INCLUDED_
 
+#include <cstdio>
 #include <vector>
 #include <string>
 using std::vector;
@@ -21,5 +22,26 @@ bool CheckForFile( const string & path, string &file );
 bool FileExist( const string & file );
 string GetFilename( const string &pathfile );
 
+FILE* OpenBufferedFile( const string & filename, const char* mode );
+
+string MakeTempDir( const string & prefix );    // Returns Path With Trailing Separator, Empty On Failure
+void RemoveDir( const string & dir );
+
+//==== One Text Record Per Index - Blocks Are Formatted Concurrently And Written In Order ====//
+class TextRecordWriter
+{
+public:
+    virtual ~TextRecordWriter()                     {}
+
+    void Write( FILE* fp, int num_rec );
+
+protected:
+
+    virtual void FormatRecord( int i, string & out ) = 0;
+
+    void Append( string & out, const char* fmt, ... );
+
+};
+
 #endif
 
@@ -0,0 +1,512 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+
+//******************************************************************************
+//
+//   Adaptive Exact Orientation Predicates And Tri-Tri Intersection
+//
+//   Expansion arithmetic follows J.R. Shewchuk, "Adaptive Precision Floating-Point
+//   Arithmetic and Fast Robust Geometric Predicates", 1997.  Requires strict IEEE
+//   double rounding (no x87 extended precision, no fused multiply-add contraction).
+//
+//******************************************************************************
+
+#include "Predicates.h"
+
+#include <cmath>
+
+//==== Error Bound For The Filtered orient3d - (7 + 56 eps) eps, eps = 2^-53 ====//
+static const double O3D_ERR_BOUND = 7.7715611723761027e-16;
+
+//==== Bound On Expansion Length In Orient3dExact - Three Products Of At Most 64 Terms Summed ====//
+static const int O3D_MAX_TERMS = 256;
+
+//==== Exact Sum x + y = a + b ====//
+static inline void TwoSum( double a, double b, double & x, double & y )
+{
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = ( a - av ) + ( b - bv );
+}
+
+//==== Split Into Two 26 Bit Halves ====//
+static inline void Split( double a, double & hi, double & lo )
+{
+    double c = 134217729.0 * a;     // 2^27 + 1
+    double big = c - a;
+    hi = c - big;
+    lo = a - hi;
+}
+
+//==== Exact Product x + y = a * b ====//
+static inline void TwoProduct( double a, double b, double & x, double & y )
+{
+    x = a * b;
+    double ahi, alo, bhi, blo;
+    Split( a, ahi, alo );
+    Split( b, bhi, blo );
+    double err1 = x - ( ahi * bhi );
+    double err2 = err1 - ( alo * bhi );
+    double err3 = err2 - ( ahi * blo );
+    y = ( alo * blo ) - err3;
+}
+
+//==== Expansions Are Nonoverlapping, Zero Free And Ordered By Increasing Magnitude ====//
+// Lengths are returned, storage is supplied by the caller so the exact path never allocates.
+static int SumExpansion( int elen, const double* e, int flen, const double* f, double* h )
+{
+    //==== Merge By Magnitude Then Carry Through One Chain Of Exact Sums ====//
+    double g[O3D_MAX_TERMS];
+    int glen = 0;
+    int i = 0;
+    int j = 0;
+    while ( i < elen && j < flen )
+    {
+        if ( std::abs( e[i] ) < std::abs( f[j] ) )
+        {
+            g[glen++] = e[i++];
+        }
+        else
+        {
+            g[glen++] = f[j++];
+        }
+    }
+    while ( i < elen )
+    {
+        g[glen++] = e[i++];
+    }
+    while ( j < flen )
+    {
+        g[glen++] = f[j++];
+    }
+
+    int hlen = 0;
+    double q = g[0];
+    for ( int k = 1 ; k < glen ; k++ )
+    {
+        double sum, err;
+        TwoSum( q, g[k], sum, err );
+        if ( err != 0.0 )
+        {
+            h[hlen++] = err;
+        }
+        q = sum;
+    }
+    if ( q != 0.0 || hlen == 0 )
+    {
+        h[hlen++] = q;
+    }
+    return hlen;
+}
+
+static int ScaleExpansion( int elen, const double* e, double b, double* h )
+{
+    int hlen = 0;
+    double q, err;
+    TwoProduct( e[0], b, q, err );
+    if ( err != 0.0 )
+    {
+        h[hlen++] = err;
+    }
+    for ( int i = 1 ; i < elen ; i++ )
+    {
+        double p1, p0, sum;
+        TwoProduct( e[i], b, p1, p0 );
+        TwoSum( q, p0, sum, err );
+        if ( err != 0.0 )
+        {
+            h[hlen++] = err;
+        }
+        TwoSum( p1, sum, q, err );
+        if ( err != 0.0 )
+        {
+            h[hlen++] = err;
+        }
+    }
+    if ( q != 0.0 || hlen == 0 )
+    {
+        h[hlen++] = q;
+    }
+    return hlen;
+}
+
+static int MultExpansion( int elen, const double* e, int flen, const double* f, double* h )
+{
+    double term[O3D_MAX_TERMS];
+    double tmp[O3D_MAX_TERMS];
+    int hlen = ScaleExpansion( elen, e, f[0], h );
+    for ( int i = 1 ; i < flen ; i++ )
+    {
+        int tlen = ScaleExpansion( elen, e, f[i], term );
+        int slen = SumExpansion( hlen, h, tlen, term, tmp );
+        for ( int j = 0 ; j < slen ; j++ )
+        {
+            h[j] = tmp[j];
+        }
+        hlen = slen;
+    }
+    return hlen;
+}
+
+//==== Exact Difference As A Two Term Expansion ====//
+static int DiffExpansion( double a, double b, double* e )
+{
+    double x, y;
+    TwoSum( a, -b, x, y );
+    if ( y != 0.0 )
+    {
+        e[0] = y;
+        e[1] = x;
+        return 2;
+    }
+    e[0] = x;
+    return 1;
+}
+
+//==== e1 * f1 - e2 * f2 ====//
+static int CrossTerm( int e1len, const double* e1, int f1len, const double* f1,
+                      int e2len, const double* e2, int f2len, const double* f2, double* h )
+{
+    double a[O3D_MAX_TERMS];
+    double b[O3D_MAX_TERMS];
+    int alen = MultExpansion( e1len, e1, f1len, f1, a );
+    int blen = MultExpansion( e2len, e2, f2len, f2, b );
+    for ( int i = 0 ; i < blen ; i++ )
+    {
+        b[i] = -b[i];
+    }
+    return SumExpansion( alen, a, blen, b, h );
+}
+
+//==== Exact Evaluation - Only Reached When The Filter Fails ====//
+static double Orient3dExact( const vec3d & a, const vec3d & b, const vec3d & c, const vec3d & d )
+{
+    double ad[3][2], bd[3][2], cd[3][2];
+    int adlen[3], bdlen[3], cdlen[3];
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        adlen[i] = DiffExpansion( a.v[i], d.v[i], ad[i] );
+        bdlen[i] = DiffExpansion( b.v[i], d.v[i], bd[i] );
+        cdlen[i] = DiffExpansion( c.v[i], d.v[i], cd[i] );
+    }
+
+    double m[O3D_MAX_TERMS];
+    double t0[O3D_MAX_TERMS];
+    double t1[O3D_MAX_TERMS];
+    double t2[O3D_MAX_TERMS];
+    double s01[O3D_MAX_TERMS];
+    double det[O3D_MAX_TERMS];
+
+    int mlen = CrossTerm( bdlen[0], bd[0], cdlen[1], cd[1], cdlen[0], cd[0], bdlen[1], bd[1], m );
+    int t0len = MultExpansion( adlen[2], ad[2], mlen, m, t0 );
+    mlen = CrossTerm( cdlen[0], cd[0], adlen[1], ad[1], adlen[0], ad[0], cdlen[1], cd[1], m );
+    int t1len = MultExpansion( bdlen[2], bd[2], mlen, m, t1 );
+    mlen = CrossTerm( adlen[0], ad[0], bdlen[1], bd[1], bdlen[0], bd[0], adlen[1], ad[1], m );
+    int t2len = MultExpansion( cdlen[2], cd[2], mlen, m, t2 );
+
+    int s01len = SumExpansion( t0len, t0, t1len, t1, s01 );
+    int detlen = SumExpansion( s01len, s01, t2len, t2, det );
+
+    //==== Largest Component Carries The Sign ====//
+    return det[detlen - 1];
+}
+
+static inline bool SamePnt( const vec3d & a, const vec3d & b )
+{
+    return a.v[0] == b.v[0] && a.v[1] == b.v[1] && a.v[2] == b.v[2];
+}
+
+//==== Filtered Evaluation, Inlined Into The Tri-Tri Kernel ====//
+static inline double Orient3d( const vec3d & a, const vec3d & b, const vec3d & c, const vec3d & d )
+{
+    double adx = a.x() - d.x();
+    double bdx = b.x() - d.x();
+    double cdx = c.x() - d.x();
+    double ady = a.y() - d.y();
+    double bdy = b.y() - d.y();
+    double cdy = c.y() - d.y();
+    double adz = a.z() - d.z();
+    double bdz = b.z() - d.z();
+    double cdz = c.z() - d.z();
+
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+
+    double det = adz * ( bdxcdy - cdxbdy ) + bdz * ( cdxady - adxcdy ) + cdz * ( adxbdy - bdxady );
+
+    double permanent = ( std::abs( bdxcdy ) + std::abs( cdxbdy ) ) * std::abs( adz )
+                     + ( std::abs( cdxady ) + std::abs( adxcdy ) ) * std::abs( bdz )
+                     + ( std::abs( adxbdy ) + std::abs( bdxady ) ) * std::abs( cdz );
+
+    //==== Every Term Exactly Zero (Coincident Or Axis Aligned Points) Needs No Exact Pass ====//
+    if ( std::abs( det ) > O3D_ERR_BOUND * permanent || permanent == 0.0 )
+    {
+        return det;
+    }
+
+    //==== Collapsed Tris At Poles And Tips Repeat A Point - Exactly Zero ====//
+    if ( SamePnt( a, b ) || SamePnt( a, c ) || SamePnt( a, d ) || SamePnt( b, c ) || SamePnt( b, d ) || SamePnt( c, d ) )
+    {
+        return 0.0;
+    }
+
+    return Orient3dExact( a, b, c, d );
+}
+
+double orient3d( const vec3d & a, const vec3d & b, const vec3d & c, const vec3d & d )
+{
+    return Orient3d( a, b, c, d );
+}
+
+//==== Plane Of A Tri With Its Cofactors Cached - Same Error Bound As orient3d, Fewer Flops Per Point ====//
+struct O3dPlane
+{
+    O3dPlane( const vec3d & a, const vec3d & b, const vec3d & c ) : m_A( a ), m_B( b ), m_C( c )
+    {
+        double ux = b.v[0] - a.v[0];
+        double uy = b.v[1] - a.v[1];
+        double uz = b.v[2] - a.v[2];
+        double vx = c.v[0] - a.v[0];
+        double vy = c.v[1] - a.v[1];
+        double vz = c.v[2] - a.v[2];
+
+        double uyvz = uy * vz;
+        double uzvy = uz * vy;
+        double uzvx = uz * vx;
+        double uxvz = ux * vz;
+        double uxvy = ux * vy;
+        double uyvx = uy * vx;
+
+        m_N[0] = uyvz - uzvy;
+        m_N[1] = uzvx - uxvz;
+        m_N[2] = uxvy - uyvx;
+        m_Perm[0] = std::abs( uyvz ) + std::abs( uzvy );
+        m_Perm[1] = std::abs( uzvx ) + std::abs( uxvz );
+        m_Perm[2] = std::abs( uxvy ) + std::abs( uyvx );
+    }
+
+    //==== Repeated Corner (Poles, Tips) - No Plane, Every Side Would Need The Exact Pass ====//
+    bool Collapsed() const
+    {
+        if ( m_N[0] != 0.0 || m_N[1] != 0.0 || m_N[2] != 0.0 )
+        {
+            return false;
+        }
+        return SamePnt( m_A, m_B ) || SamePnt( m_B, m_C ) || SamePnt( m_C, m_A );
+    }
+
+    //==== Same Sign As orient3d( a, b, c, d ) ====//
+    double Side( const vec3d & d ) const
+    {
+        double wx = d.v[0] - m_A.v[0];
+        double wy = d.v[1] - m_A.v[1];
+        double wz = d.v[2] - m_A.v[2];
+
+        double det = wx * m_N[0] + wy * m_N[1] + wz * m_N[2];
+        double permanent = std::abs( wx ) * m_Perm[0] + std::abs( wy ) * m_Perm[1] + std::abs( wz ) * m_Perm[2];
+
+        if ( std::abs( det ) > O3D_ERR_BOUND * permanent || permanent == 0.0 )
+        {
+            return -det;
+        }
+
+        return Orient3d( m_A, m_B, m_C, d );
+    }
+
+    const vec3d & m_A;
+    const vec3d & m_B;
+    const vec3d & m_C;
+    double m_N[3];
+    double m_Perm[3];
+};
+
+static inline int Sign( double d )
+{
+    return ( d > 0.0 ) - ( d < 0.0 );
+}
+
+//==== Points Where A Tri Meets The Other Plane, Each Tagged With An Edge (Hi, Lo) Through It ====//
+// d holds the exact-signed plane values of the three corners.  Hi is strictly above Lo.
+static int PlaneCrossPnts( const vec3d* v[3], const double d[3], int hi[2], int lo[2], double pnt[2][3] )
+{
+    int n = 0;
+
+    //==== Corners On The Plane ====//
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        if ( d[k] == 0.0 )
+        {
+            int j = ( d[( k + 1 ) % 3] != 0.0 ) ? ( k + 1 ) % 3 : ( k + 2 ) % 3;
+            hi[n] = ( d[j] < 0.0 ) ? k : j;
+            lo[n] = ( d[j] < 0.0 ) ? j : k;
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                pnt[n][i] = v[k]->v[i];
+            }
+            n++;
+        }
+    }
+
+    //==== Edges Crossing The Plane ====//
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        int j = ( k + 1 ) % 3;
+        if ( Sign( d[k] ) * Sign( d[j] ) < 0 )
+        {
+            hi[n] = ( d[k] > 0.0 ) ? k : j;
+            lo[n] = ( d[k] > 0.0 ) ? j : k;
+            double t = d[hi[n]] / ( d[hi[n]] - d[lo[n]] );
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                pnt[n][i] = v[hi[n]]->v[i] + ( v[lo[n]]->v[i] - v[hi[n]]->v[i] ) * t;
+            }
+            n++;
+        }
+    }
+
+    return n;
+}
+
+static inline double DistSq( const double* a, const double* b )
+{
+    double dx = a[0] - b[0];
+    double dy = a[1] - b[1];
+    double dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+int tri_tri_isect_exact( const vec3d & p0, const vec3d & p1, const vec3d & p2,
+                         const vec3d & q0, const vec3d & q1, const vec3d & q2,
+                         int & coplanar, vec3d & e0, vec3d & e1 )
+{
+    coplanar = 0;
+
+    const vec3d* pv[3] = { &p0, &p1, &p2 };
+    const vec3d* qv[3] = { &q0, &q1, &q2 };
+
+    //==== P Entirely On One Side Of Plane Q ====//
+    O3dPlane qplane( q0, q1, q2 );
+    if ( qplane.Collapsed() )
+    {
+        coplanar = 1;
+        return 0;
+    }
+
+    double dp[3];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        dp[k] = qplane.Side( *pv[k] );
+    }
+
+    int sp = Sign( dp[0] ) + Sign( dp[1] ) + Sign( dp[2] );
+    if ( sp == 3 || sp == -3 )
+    {
+        return 0;
+    }
+    if ( dp[0] == 0.0 && dp[1] == 0.0 && dp[2] == 0.0 )
+    {
+        coplanar = 1;
+        return 0;
+    }
+
+    //==== Q Entirely On One Side Of Plane P ====//
+    O3dPlane pplane( p0, p1, p2 );
+    if ( pplane.Collapsed() )
+    {
+        coplanar = 1;
+        return 0;
+    }
+
+    double dq[3];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        dq[k] = pplane.Side( *qv[k] );
+    }
+
+    int sq = Sign( dq[0] ) + Sign( dq[1] ) + Sign( dq[2] );
+    if ( sq == 3 || sq == -3 )
+    {
+        return 0;
+    }
+
+    //==== Each Tri Meets The Common Line In A Segment (Or Single Point) ====//
+    int phi[2], plo[2], qhi[2], qlo[2];
+    double ppnt[2][3];
+    double qpnt[2][3];
+    int np = PlaneCrossPnts( pv, dp, phi, plo, ppnt );
+    int nq = PlaneCrossPnts( qv, dq, qhi, qlo, qpnt );
+
+    //==== Order Of Point i Of P And Point j Of Q Along The Line Is The Sign Of orient3d Of Their Edges ====//
+    int cmp[2][2];
+    for ( int i = 0 ; i < np ; i++ )
+    {
+        for ( int j = 0 ; j < nq ; j++ )
+        {
+            cmp[i][j] = Sign( Orient3d( *pv[phi[i]], *pv[plo[i]], *qv[qhi[j]], *qv[qlo[j]] ) );
+        }
+    }
+
+    //==== Separated When Every Pair Has The Same Strict Order ====//
+    int first = cmp[0][0];
+    bool separated = ( first != 0 );
+    for ( int i = 0 ; i < np && separated ; i++ )
+    {
+        for ( int j = 0 ; j < nq && separated ; j++ )
+        {
+            separated = ( cmp[i][j] == first );
+        }
+    }
+    if ( separated )
+    {
+        return 0;
+    }
+
+    //==== Segment Ends Are The Points Lying Within The Other Tri's Interval ====//
+    const double* inside[4];
+    int ninside = 0;
+    for ( int i = 0 ; i < np ; i++ )
+    {
+        if ( ( nq == 1 && cmp[i][0] == 0 ) || ( nq == 2 && cmp[i][0] * cmp[i][1] <= 0 ) )
+        {
+            inside[ninside++] = ppnt[i];
+        }
+    }
+    for ( int j = 0 ; j < nq ; j++ )
+    {
+        if ( ( np == 1 && cmp[0][j] == 0 ) || ( np == 2 && cmp[0][j] * cmp[1][j] <= 0 ) )
+        {
+            inside[ninside++] = qpnt[j];
+        }
+    }
+
+    //==== Coincident Ends Give Extra Points - Keep The Farthest Pair ====//
+    int i0 = 0;
+    int i1 = 0;
+    double dmax = -1.0;
+    for ( int i = 0 ; i < ninside ; i++ )
+    {
+        for ( int j = i + 1 ; j < ninside ; j++ )
+        {
+            double d2 = DistSq( inside[i], inside[j] );
+            if ( d2 > dmax )
+            {
+                dmax = d2;
+                i0 = i;
+                i1 = j;
+            }
+        }
+    }
+
+    e0.set_xyz( inside[i0][0], inside[i0][1], inside[i0][2] );
+    e1.set_xyz( inside[i1][0], inside[i1][1], inside[i1][2] );
+
+    return 1;
+}
@@ -0,0 +1,32 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+
+//******************************************************************************
+//
+//   Adaptive Exact Orientation Predicates And Tri-Tri Intersection
+//
+//   Orientation signs are decided with a floating point filter and fall back
+//   to exact expansion arithmetic only when the filter cannot certify them.
+//
+//******************************************************************************
+
+#ifndef VSPPREDICATES_H
+#define VSPPREDICATES_H
+
+#include "Vec3d.h"
+
+//==== Sign Of Volume Of Tetra abcd - Positive When d Is Below The CCW Plane abc ====//
+// The sign is always exact, the magnitude is a floating point approximation.
+double orient3d( const vec3d & a, const vec3d & b, const vec3d & c, const vec3d & d );
+
+//==== Tri-Tri Intersection With All Topological Decisions Made By orient3d ====//
+// Returns 1 and the segment e0-e1 when the tris intersect.  Exactly coplanar tris
+// set coplanar and return 0.  Touching configurations return a zero length segment.
+int tri_tri_isect_exact( const vec3d & p0, const vec3d & p1, const vec3d & p2,
+                         const vec3d & q0, const vec3d & q1, const vec3d & q2,
+                         int & coplanar, vec3d & e0, vec3d & e1 );
+
+#endif
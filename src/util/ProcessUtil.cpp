@@ -20,6 +20,7 @@
 
 #include <fcntl.h>
 #include <signal.h>
+#include <poll.h>
 #endif
 
 
@@ -340,6 +341,114 @@ bool ProcessUtil::IsRunning()
     return true;
 }
 
+int ProcessUtil::WaitForAnyExit( const vector< ProcessUtil* > & proc_vec )
+{
+#ifdef WIN32
+    //==== Wakes As Soon As A Process Ends - The Timeout Only Paces Pipe Draining ====//
+    while ( true )
+    {
+        vector< HANDLE > handle_vec;
+        vector< int > ind_vec;
+        for ( int i = 0 ; i < ( int )proc_vec.size() ; i++ )
+        {
+            if ( proc_vec[i]->pi.dwProcessId != 0 && handle_vec.size() < MAXIMUM_WAIT_OBJECTS )
+            {
+                handle_vec.push_back( proc_vec[i]->pi.hProcess );
+                ind_vec.push_back( i );
+            }
+        }
+
+        if ( handle_vec.empty() )
+        {
+            return -1;
+        }
+
+        for ( int i = 0 ; i < ( int )ind_vec.size() ; i++ )
+        {
+            proc_vec[ ind_vec[i] ]->FlushStdoutPipe();
+        }
+
+        DWORD ret = WaitForMultipleObjects( ( DWORD )handle_vec.size(), &handle_vec[0], FALSE, 100 );
+        if ( ret >= WAIT_OBJECT_0 && ret < WAIT_OBJECT_0 + handle_vec.size() )
+        {
+            int i = ind_vec[ ret - WAIT_OBJECT_0 ];
+            proc_vec[i]->IsRunning();            // Closes The Process Handles
+            proc_vec[i]->FlushStdoutPipe();
+            return i;
+        }
+        else if ( ret == WAIT_FAILED )
+        {
+            return -1;
+        }
+    }
+#else
+    //==== A Child Closes Its End Of The Pipe When It Exits, So Waiting On The Pipes Covers Both ====//
+    while ( true )
+    {
+        vector< pollfd > fd_vec;
+        vector< int > ind_vec;
+        for ( int i = 0 ; i < ( int )proc_vec.size() ; i++ )
+        {
+            ProcessUtil* proc = proc_vec[i];
+            if ( proc->childPid == -1 )
+            {
+                continue;
+            }
+
+            if ( proc->m_StdoutPipe[PIPE_READ] < 0 )
+            {
+                int status;
+                waitpid( proc->childPid, &status, 0 );
+                proc->childPid = -1;
+                return i;
+            }
+
+            pollfd pfd;
+            pfd.fd = proc->m_StdoutPipe[PIPE_READ];
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            fd_vec.push_back( pfd );
+            ind_vec.push_back( i );
+        }
+
+        if ( fd_vec.empty() )
+        {
+            return -1;
+        }
+
+        if ( poll( &fd_vec[0], fd_vec.size(), -1 ) < 0 )
+        {
+            continue;                               // Interrupted By A Signal
+        }
+
+        for ( int j = 0 ; j < ( int )fd_vec.size() ; j++ )
+        {
+            if ( fd_vec[j].revents == 0 )
+            {
+                continue;
+            }
+
+            ProcessUtil* proc = proc_vec[ ind_vec[j] ];
+
+            char buf[1000];
+            ssize_t nread;
+            while ( ( nread = read( fd_vec[j].fd, buf, sizeof( buf ) ) ) > 0 )
+            {
+            }
+
+            if ( nread == 0 || ( fd_vec[j].revents & ( POLLHUP | POLLERR | POLLNVAL ) ) )
+            {
+                proc->CloseStdoutPipe();
+                int status;
+                waitpid( proc->childPid, &status, 0 );
+                proc->childPid = -1;
+                return ind_vec[j];
+            }
+        }
+    }
+#endif
+}
+
 #ifdef WIN32
 void ProcessUtil::StartThread( LPTHREAD_START_ROUTINE threadfun, LPVOID data )
 {
@@ -378,6 +487,43 @@ void ProcessUtil::ReadStdoutPipe(char * bufptr, int bufsize, unsigned long * nre
 #endif
 }
 
+void ProcessUtil::FlushStdoutPipe()
+{
+    char buf[1000];
+#ifdef WIN32
+    DWORD navail = 0;
+    while ( PeekNamedPipe( m_StdoutPipe[PIPE_READ], NULL, 0, NULL, &navail, NULL ) && navail > 0 )
+    {
+        DWORD nread = 0;
+        if ( !ReadFile( m_StdoutPipe[PIPE_READ], buf, sizeof( buf ), &nread, NULL ) || nread == 0 )
+        {
+            break;
+        }
+    }
+#else
+    while ( read( m_StdoutPipe[PIPE_READ], buf, sizeof( buf ) ) > 0 )
+    {
+    }
+#endif
+}
+
+void ProcessUtil::CloseStdoutPipe()
+{
+#ifdef WIN32
+    if ( m_StdoutPipe[PIPE_READ] )
+    {
+        CloseHandle( m_StdoutPipe[PIPE_READ] );
+        m_StdoutPipe[PIPE_READ] = NULL;
+    }
+#else
+    if ( m_StdoutPipe[PIPE_READ] >= 0 )
+    {
+        close( m_StdoutPipe[PIPE_READ] );
+        m_StdoutPipe[PIPE_READ] = -1;
+    }
+#endif
+}
+
 /* PrettyCmd( path, cmd, opts )
     Returns a command string that could be used on the command line
 */
@@ -39,7 +39,12 @@ public:
 
     bool IsRunning();
 
+    //==== Block Until One Of The Running Processes Exits, Draining Their Output - Index Or -1 ====//
+    static int WaitForAnyExit( const vector< ProcessUtil* > & proc_vec );
+
     void ReadStdoutPipe(char * buf, int bufsize, unsigned long * nread );
+    void FlushStdoutPipe();     // Discard pending child output without blocking
+    void CloseStdoutPipe();
 
     string PrettyCmd( const string &path, const string &cmd, const vector<string> &opts ); //returns a command string that could be used on the command line
 
@@ -10,6 +10,7 @@
 #include <float.h>
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "Predicates.h"
 
 
 //==== Test vec2d ====//
@@ -665,3 +666,36 @@ void UtilTestSuite::BilinearInterpTest()
     TEST_ASSERT_DELTA( interp_val, 9.8125, DBL_EPSILON );
 
 }
+
+void UtilTestSuite::PredicatesTest()
+{
+    //==== Points On The Plane z = x - Naive Determinant Is Polluted By Rounding ====//
+    vec3d a( 0.1, 0.7, 0.1 );
+    vec3d b( 0.3, 0.2, 0.3 );
+    vec3d c( 0.9, 0.4, 0.9 );
+    vec3d d( 0.123456789, 0.987654321, 0.123456789 );
+    TEST_ASSERT( orient3d( a, b, c, d ) == 0.0 );
+    TEST_ASSERT( orient3d( a, b, c, vec3d( 0.5, 0.5, 0.5 + 1.0e-15 ) ) * orient3d( a, b, c, vec3d( 0.5, 0.5, 0.5 - 1.0e-15 ) ) < 0.0 );
+
+    int coplanar;
+    vec3d e0, e1;
+
+    //==== Exactly Coplanar Tris ====//
+    int iflag = tri_tri_isect_exact( vec3d( 0, 0, 0 ), vec3d( 1, 0, 0 ), vec3d( 0, 1, 0 ),
+                                     vec3d( 0.2, 0.2, 0 ), vec3d( 2, 0.2, 0 ), vec3d( 0.2, 2, 0 ), coplanar, e0, e1 );
+    TEST_ASSERT( iflag == 0 && coplanar == 1 );
+
+    //==== Small Tris Crossing At Right Angles - Scale Must Not Matter ====//
+    double s = 1.0e-7;
+    iflag = tri_tri_isect_exact( vec3d( 0, 0, 0 ), vec3d( s, 0, 0 ), vec3d( 0, s, 0 ),
+                                 vec3d( 0.25 * s, -s, -s ), vec3d( 0.25 * s, s, -s ), vec3d( 0.25 * s, 0, s ), coplanar, e0, e1 );
+    TEST_ASSERT( iflag == 1 && coplanar == 0 );
+    TEST_ASSERT_DELTA( e0.x(), 0.25 * s, 1.0e-20 );
+    TEST_ASSERT_DELTA( e1.x(), 0.25 * s, 1.0e-20 );
+    TEST_ASSERT_DELTA( std::abs( e1.y() - e0.y() ), 0.5 * s, 1.0e-20 );
+
+    //==== Disjoint ====//
+    iflag = tri_tri_isect_exact( vec3d( 0, 0, 0 ), vec3d( 1, 0, 0 ), vec3d( 0, 1, 0 ),
+                                 vec3d( 2, 2, -1 ), vec3d( 2, 3, 1 ), vec3d( 3, 2, 1 ), coplanar, e0, e1 );
+    TEST_ASSERT( iflag == 0 );
+}